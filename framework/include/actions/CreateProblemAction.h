@@ -34,6 +34,7 @@ protected:
   std::vector<SubdomainName> _blocks;
   MultiMooseEnum _coord_sys;
   bool _fe_cache;
+  bool _affine_fe_tables;
 };
 
 #endif /* CREATEPROBLEMACTION_H */
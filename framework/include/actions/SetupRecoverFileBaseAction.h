@@ -61,6 +61,14 @@ private:
    * @param The most current checkpoing file base
    */
   std::string getRecoveryFileBase(const std::set<std::string> checkpoint_files);
+
+  /**
+   * Check that a checkpoint was completely written
+   * @param base The file base of the checkpoint (e.g. out_cp/0005)
+   * @param checkpoint_files The checkpoint files found on disk
+   * @return True when the solution and restartable data files of all the processors are there
+   */
+  bool isCompleteCheckpoint(const std::string & base, const std::set<std::string> & checkpoint_files);
 };
 
 #endif //SETUPRECOVERFILEBASEACTION_H
@@ -25,6 +25,7 @@
 
 class AuxKernel;
 class AuxScalarKernel;
+class MooseVariable;
 
 /**
  * Warehouse for storing auxiliary kernels
@@ -49,6 +50,14 @@ public:
   const std::vector<AuxKernel *> & activeBlockNodalKernels(SubdomainID block) { return _active_block_nodal_aux_kernels[block]; }
   const std::vector<AuxKernel *> & activeBlockElementKernels(SubdomainID block) { return _active_block_element_aux_kernels[block]; }
 
+  /**
+   * Get the variables that the elemental kernels active on a block depend on (built the first time the
+   * block is requested)
+   * @param block The subdomain
+   * @return The set of MooseVariables needed on the block
+   */
+  const std::set<MooseVariable *> & activeBlockElementKernelDependencies(SubdomainID block);
+
   const std::vector<AuxKernel *> & activeBCs(BoundaryID boundary_id) { return _active_nodal_bcs[boundary_id]; }
   const std::vector<AuxKernel *> & allElementalBCs() { return _all_elem_bcs; }
   const std::vector<AuxKernel *> & elementalBCs(BoundaryID boundary_id) { return _elem_bcs[boundary_id]; }
@@ -82,6 +91,8 @@ protected:
   std::map<SubdomainID, std::vector<AuxKernel *> > _active_block_nodal_aux_kernels;
   /// elemental kernels active on a block
   std::map<SubdomainID, std::vector<AuxKernel *> > _active_block_element_aux_kernels;
+  /// variables needed by the elemental kernels active on a block (built on demand)
+  std::map<SubdomainID, std::set<MooseVariable *> > _block_element_dependencies;
 
   /// nodal aux boundary conditions
   std::map<BoundaryID, std::vector<AuxKernel *> > _active_nodal_bcs;
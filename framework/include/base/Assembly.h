@@ -16,6 +16,7 @@
 #define ASSEMBLY_H
 
 #include <vector>
+#include <set>
 #include "ParallelUniqueId.h"
 #include "MooseVariable.h"
 #include "MooseVariableScalar.h"
@@ -315,6 +316,25 @@ public:
    */
   void useFECache(bool fe_cache) { _should_use_fe_cache = fe_cache; }
 
+  /**
+   * Limit the memory used by the FE shape function cache.  Elements that are reached once the budget is
+   * used up are not cached, their shape functions are recomputed on every reinit.
+   *
+   * @param bytes The budget in bytes (0 means no limit)
+   */
+  void setFECacheMemoryBudget(std::size_t bytes) { _fe_cache_memory_budget = bytes; }
+
+  /**
+   * Whether or not the volume shape functions of first order elements with an affine map should be
+   * served from precomputed reference element tables.  The gradients, quadrature points and JxW are
+   * then built from the constant element Jacobian instead of reinitializing the libMesh FE objects.
+   * The FEBase objects handed out by getFE() are still reinitialized on those elements, so only
+   * ask for them when the libMesh FE data is really needed.
+   *
+   * @param affine_tables True for using the tables false for not.
+   */
+  void useAffineFETables(bool affine_tables) { _use_affine_fe_tables = affine_tables; }
+
   void prepare();
 
   /**
@@ -353,6 +373,15 @@ public:
    */
   void addCachedResidual(NumericVector<Number> & residual, Moose::KernelType type);
 
+  /**
+   * Adds the cached residual values of the locally owned dofs straight into local_residual (indexed by
+   * dof - first_local_dof).  The values for the other dofs stay cached until addCachedResidual() is called.
+   *
+   * There is no locking here: this is meant for the colored assembly, where no two threads work on
+   * elements sharing dofs at the same time.
+   */
+  void addCachedResidualLocal(std::vector<Number> & local_residual, dof_id_type first_local_dof, Moose::KernelType type);
+
   void setResidual(NumericVector<Number> & residual, Moose::KernelType type = Moose::KT_NONTIME);
   void setResidualNeighbor(NumericVector<Number> & residual, Moose::KernelType type = Moose::KT_NONTIME);
 
@@ -380,6 +409,14 @@ public:
    */
   void addCachedJacobian(SparseMatrix<Number> & jacobian);
 
+  /**
+   * Set whether cacheJacobian() should gather all the coupled variable blocks of an element into one
+   * dense matrix (one per row variable if the coupling is not full) so that addCachedJacobian() inserts
+   * each of them with a single call instead of entry by entry.
+   */
+  void useBatchedJacobian(bool batched) { _batched_jacobian = batched; }
+  bool usesBatchedJacobian() const { return _batched_jacobian; }
+
   DenseVector<Number> & residualBlock(unsigned int var_num, Moose::KernelType type = Moose::KT_NONTIME) { return _sub_Re[static_cast<unsigned int>(type)][var_num]; }
   DenseVector<Number> & residualBlockNeighbor(unsigned int var_num, Moose::KernelType type = Moose::KT_NONTIME) { return _sub_Rn[static_cast<unsigned int>(type)][var_num]; }
 
@@ -419,6 +456,11 @@ public:
    */
   void invalidateCache();
 
+  /**
+   * Throw away all of the cached data (the elements the data was cached for might not exist anymore).
+   */
+  void clearCache();
+
   std::map<FEType, bool> _need_second_derivative;
 
   /**
@@ -456,6 +498,15 @@ protected:
    */
   void reinitFE(const Elem * elem);
 
+  /**
+   * Reinit the volume shape functions, quadrature points and JxW of an affine first order element from
+   * the reference element tables.
+   *
+   * @param elem The element we are using to reinit
+   * @return false if the element (or one of the FE types) is not supported, nothing is set in that case
+   */
+  bool reinitAffineFE(const Elem * elem);
+
   /**
    * Just an internal helper function to reinit the face FE objects.
    *
@@ -475,6 +526,12 @@ protected:
 
   void addJacobianBlock(SparseMatrix<Number> & jacobian, DenseMatrix<Number> & jac_block, const std::vector<dof_id_type> & idof_indices, const std::vector<dof_id_type> & jdof_indices, Real scaling_factor);
 
+  /**
+   * Gather the jacobian blocks of the field variables on the current element into element matrices taken
+   * from the pool (used by cacheJacobian() in batched mode)
+   */
+  void cacheElementJacobian();
+
   SystemBase & _sys;
   /// Reference to coupling matrix
   CouplingMatrix * & _cm;
@@ -661,6 +718,9 @@ protected:
 
     /// Cached xyz positions of quadrature points
     MooseArray<Point> _q_points;
+
+    /// Number of bytes held by the cached arrays
+    std::size_t _memory;
   };
 
   /// Cached shape function values stored by element
@@ -672,6 +732,46 @@ protected:
   /// Whether or not fe should currently be cached - This will be false if something funky is going on with the quadrature rules.
   bool _currently_fe_caching;
 
+  /// Maximum number of bytes held by _element_fe_shape_data_cache (0 means no limit)
+  std::size_t _fe_cache_memory_budget;
+
+  /// Number of bytes currently held by _element_fe_shape_data_cache
+  std::size_t _fe_cache_memory_used;
+
+  /**
+   * Shape functions of one FE type on one reference element evaluated at the points of the volume
+   * quadrature rule.  Only the physical gradients change from one element to the next.
+   */
+  class AffineFETable
+  {
+  public:
+    /// Shape function values [i][qp]
+    std::vector<std::vector<Real> > _phi;
+    /// Shape function gradients with respect to the reference coordinates [i][qp]
+    std::vector<std::vector<RealGradient> > _ref_grad_phi;
+    /// Physical gradients on the current element [i][qp]
+    std::vector<std::vector<RealGradient> > _grad_phi;
+  };
+
+  /**
+   * Build (the first time) and return the table for a reference element and FE type.  The volume
+   * quadrature rule has to be initialized for the element type.
+   */
+  AffineFETable & getAffineFETable(ElemType elem_type, unsigned int dim, const FEType & fe_type);
+
+  /// Whether or not the affine reference element tables should be used
+  bool _use_affine_fe_tables;
+  /// Reference element tables (cleared whenever the quadrature rules are rebuilt)
+  std::map<std::pair<ElemType, FEType>, AffineFETable> _affine_fe_tables;
+  /// Quadrature points of the current element when the affine tables are used
+  std::vector<Point> _affine_q_points;
+  /// JxW of the current element when the affine tables are used
+  std::vector<Real> _affine_JxW;
+  /// The volume FE types handed out by getFE() for each dimension, the affine path has to reinit those FE objects too
+  std::map<unsigned int, std::set<FEType> > _requested_fe;
+  /// The element the affine tables were last used for (NULL when the FE objects were reinitialized)
+  const Elem * _affine_elem;
+
   // Shape function values, gradients. second derivatives for each FE type
   std::map<FEType, FEShapeData * > _fe_shape_data;
   std::map<FEType, FEShapeData * > _fe_shape_data_face;
@@ -694,6 +794,20 @@ protected:
 
   unsigned int _max_cached_jacobians;
 
+  /// Whether the element jacobians are cached as whole matrices (see useBatchedJacobian())
+  bool _batched_jacobian;
+  ///@{
+  /// Pool of element matrices and their dof indices cached in batched mode.  The pool only grows, so the
+  /// storage is reused from one element (and one Newton step) to the next.
+  std::vector<DenseMatrix<Number> > _cached_element_jacobians;
+  std::vector<std::vector<dof_id_type> > _cached_element_rows;
+  std::vector<std::vector<dof_id_type> > _cached_element_cols;
+  ///@}
+  /// Number of entries of the pool currently in use
+  unsigned int _n_cached_element_jacobians;
+  /// Offset of each field variable's dofs in the element matrix
+  std::vector<unsigned int> _element_dof_offsets;
+
   /// Will be true if our preconditioning matrix is a block-diagonal matrix.  Which means that we can take some shortcuts.
   unsigned int _block_diagonal_matrix;
 
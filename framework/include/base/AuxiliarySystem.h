@@ -19,6 +19,7 @@
 #include "SystemBase.h"
 #include "ExecStore.h"
 #include "AuxWarehouse.h"
+#include "UserObjectWarehouse.h"
 #include "TimeIntegrator.h"
 
 // libMesh include
@@ -95,6 +96,29 @@ public:
    */
   virtual void compute(ExecFlagType type);
 
+  /**
+   * Compute the scalar and nodal auxiliary variables, the first part of compute()
+   * @param type Time flag of which variables should be computed
+   */
+  void computeScalarAndNodalVars(ExecFlagType type);
+
+  /**
+   * Compute the elemental auxiliary variables, the second part of compute()
+   * @param type Time flag of which variables should be computed
+   * @param user_objects If not NULL, the element, side and internal side user objects of this warehouse
+   *                     are executed in the same element loop as the elemental aux kernels
+   * @param group The group of user objects to execute
+   */
+  void computeElementalVarsAndUserObjects(ExecFlagType type, std::vector<UserObjectWarehouse> * user_objects = NULL,
+                                          UserObjectWarehouse::GROUP group = UserObjectWarehouse::ALL);
+
+  /**
+   * Get the variables computed by the elemental aux kernels and boundary conditions (thread 0 copies)
+   * @param type Execution flag type
+   * @return The set of elemental variables
+   */
+  std::set<MooseVariable *> getElementalVariables(ExecFlagType type);
+
   /**
    * Get a list of dependent UserObjects for this exec type
    * @param type Execution flag type
@@ -128,7 +152,7 @@ public:
 protected:
   void computeScalarVars(ExecFlagType type);
   void computeNodalVars(ExecFlagType type);
-  void computeElementalVars(ExecFlagType type);
+  void computeElementalVars(ExecFlagType type, std::vector<UserObjectWarehouse> * user_objects, UserObjectWarehouse::GROUP group);
 
   FEProblem & _fe_problem;
 
@@ -154,6 +178,7 @@ protected:
   friend class ComputeNodalAuxVarsThread;
   friend class ComputeNodalAuxBcsThread;
   friend class ComputeElemAuxVarsThread;
+  friend class ComputeAuxAndUserObjectsThread;
   friend class ComputeElemAuxBcsThread;
   friend class ComputeIndicatorThread;
   friend class ComputeMarkerThread;
@@ -0,0 +1,48 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPUTEAUXANDUSEROBJECTSTHREAD_H
+#define COMPUTEAUXANDUSEROBJECTSTHREAD_H
+
+#include "ComputeUserObjectsThread.h"
+#include "AuxWarehouse.h"
+
+class AuxiliarySystem;
+
+/**
+ * Executes the elemental aux kernels and the element, side and internal side user objects in
+ * one pass over the elements, so that each element is reinitialized (and its materials computed) once.
+ * On each element the aux kernels run first.  The user objects must not use the elemental aux
+ * variables computed here (see FEProblem::canFuseAuxAndUserObjects()).
+ */
+class ComputeAuxAndUserObjectsThread : public ComputeUserObjectsThread
+{
+public:
+  ComputeAuxAndUserObjectsThread(FEProblem & problem, AuxiliarySystem & aux_sys, std::vector<AuxWarehouse> & auxs, std::vector<UserObjectWarehouse> & user_objects, UserObjectWarehouse::GROUP group);
+  // Splitting Constructor
+  ComputeAuxAndUserObjectsThread(ComputeAuxAndUserObjectsThread & x, Threads::split split);
+
+  virtual ~ComputeAuxAndUserObjectsThread();
+
+  virtual void subdomainChanged();
+  virtual void onElement(const Elem *elem);
+
+  void join(const ComputeAuxAndUserObjectsThread & /*y*/);
+
+protected:
+  AuxiliarySystem & _aux_sys;
+  std::vector<AuxWarehouse> & _auxs;
+};
+
+#endif //COMPUTEAUXANDUSEROBJECTSTHREAD_H
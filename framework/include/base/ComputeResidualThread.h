@@ -27,7 +27,11 @@ class NonlinearSystem;
 class ComputeResidualThread : public ThreadedElementLoop<ConstElemRange>
 {
 public:
-  ComputeResidualThread(FEProblem & fe_problem, NonlinearSystem & sys, Moose::KernelType type);
+  /**
+   * @param colored true when the range holds elements of a single color (see
+   *        NonlinearSystem::computeResidualColored()), the cached residuals are then added without locking
+   */
+  ComputeResidualThread(FEProblem & fe_problem, NonlinearSystem & sys, Moose::KernelType type, bool colored = false);
   // Splitting Constructor
   ComputeResidualThread(ComputeResidualThread & x, Threads::split split);
 
@@ -46,6 +50,7 @@ protected:
   NonlinearSystem & _sys;
   Moose::KernelType _kernel_type;
   unsigned int _num_cached;
+  bool _colored;
 };
 
 #endif //COMPUTERESIDUALTHREAD_H
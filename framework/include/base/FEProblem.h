@@ -52,6 +52,7 @@ class RandomInterface;
 class RandomData;
 class MeshChangedInterface;
 class MultiMooseEnum;
+class DeferredReductions;
 
 template<>
 InputParameters validParams<FEProblem>();
@@ -283,6 +284,21 @@ public:
    */
   virtual void useFECache(bool fe_cache);
 
+  /**
+   * Limit the memory used by the FE shape function cache.
+   *
+   * @param megabytes The budget shared by all of the threads (0 means no limit)
+   */
+  void setFECacheMemoryBudget(Real megabytes);
+
+  /**
+   * Whether or not the volume shape functions of affine first order elements should be served from
+   * precomputed reference element tables (see Assembly::useAffineFETables()).
+   *
+   * @param affine_tables True for using the tables false for not.
+   */
+  virtual void useAffineFETables(bool affine_tables);
+
   virtual void init();
   virtual void solve();
 
@@ -569,6 +585,14 @@ public:
   virtual void computeUserObjects(ExecFlagType type = EXEC_TIMESTEP_END, UserObjectWarehouse::GROUP group = UserObjectWarehouse::ALL);
   virtual void computeAuxiliaryKernels(ExecFlagType type = EXEC_LINEAR);
 
+  /**
+   * Compute the auxiliary kernels and then the user objects that do not depend on them (the POST_AUX group).
+   * When the problem is set up for it, the elemental auxiliary kernels and the element, side and internal side
+   * user objects share one pass over the elements (see canFuseAuxAndUserObjects()).
+   * @param type The execution flag
+   */
+  virtual void computeAuxiliaryKernelsAndUserObjects(ExecFlagType type = EXEC_LINEAR);
+
   // Dampers /////
   void addDamper(std::string damper_name, const std::string & name, InputParameters parameters);
   void setupDampers();
@@ -986,7 +1010,31 @@ protected:
   /// Objects to be notified when the mesh changes
   std::vector<MeshChangedInterface *> _notify_when_mesh_changes;
 
-  void computeUserObjectsInternal(ExecFlagType type, UserObjectWarehouse::GROUP group);
+  /**
+   * Compute the user objects of a group.
+   * @param with_aux If true the auxiliary variables are computed as well, with the elemental auxiliary kernels
+   *                 executed in the element loop of the user objects
+   */
+  void computeUserObjectsInternal(ExecFlagType type, UserObjectWarehouse::GROUP group, bool with_aux = false);
+
+  /**
+   * Call the residualSetup() or jacobianSetup() of the user objects executed at a flag
+   */
+  void setupUserObjects(ExecFlagType type);
+
+  /**
+   * Whether the elemental auxiliary kernels and the POST_AUX element, side and internal side user objects of a flag
+   * can be executed in the same element loop.  This is the case when fused_aux_user_object_loop is set, there is
+   * something to fuse and neither the user objects nor the materials on their blocks use the elemental auxiliary
+   * variables computed in the loop.
+   */
+  bool canFuseAuxAndUserObjects(ExecFlagType type);
+
+  /**
+   * Performs the reductions registered by finalized postprocessors all at once, then stores their
+   * values in every thread and empties the arguments
+   */
+  void storeDeferredPostprocessorValues(DeferredReductions & reductions, std::vector<Postprocessor *> & pps, std::vector<std::string> & names);
 
 protected:
   void checkUserObjects();
@@ -1067,6 +1115,17 @@ private:
 
   bool _error_on_jacobian_nonzero_reallocation;
 
+  /// Whether or not to build the read-only indices for the stateful material property storage
+  bool _lock_free_stateful_lookup;
+
+  /// Whether or not the elemental aux kernels and user objects may share one element loop
+  bool _fuse_aux_user_object_loop;
+
+  /**
+   * Build the read-only indices of the stateful material property storage (see MaterialPropertyStorage::buildReadOnlyIndex())
+   */
+  void buildStatefulIndices();
+
   /**
    * NOTE: This is an internal function meant for MOOSE use only!
    *
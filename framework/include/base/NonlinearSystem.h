@@ -74,6 +74,9 @@ public:
   virtual void timestepSetup();
 
   void setupFiniteDifferencedPreconditioner();
+  /// Whether the finite differenced preconditioner is colored from an assembled Jacobian on every solve
+  bool fdpStructureFromJacobian();
+  void setupMatrixFreeOperator();
   void setupDecomposition();
   void setupSplitBasedPreconditioner();
 
@@ -286,6 +289,23 @@ public:
    */
   void setPreconditioner(MooseSharedPointer<MoosePreconditioner> pc);
 
+#ifdef LIBMESH_HAVE_PETSC
+  /**
+   * Called by PETSc when the Jacobian of the MOOSE matrix-free operator is requested: stores the
+   * linearization point and its residual, and assembles the preconditioning matrix
+   * @param x The Newton iterate
+   * @param pc The preconditioning matrix
+   */
+  void computeMatrixFreeJacobian(Vec x, Mat pc);
+
+  /**
+   * Action of the MOOSE matrix-free operator: y = (F(u + h v) - F(u)) / h
+   * @param v The Krylov vector
+   * @param y The product
+   */
+  void applyMatrixFreeOperator(Vec v, Vec y);
+#endif
+
   /**
    * If called with true this system will use a finite differenced form of
    * the Jacobian as the preconditioner
@@ -385,6 +405,18 @@ public:
 
   Moose::PCSideType getPCSide() { return _pc_side; }
 
+  /**
+   * Set whether the residual should be assembled over colored element ranges (see
+   * MooseMesh::getColoredActiveLocalElementRanges()), accumulating the local dofs without locking
+   */
+  void useColoredAssembly(bool colored) { _use_colored_assembly = colored; }
+
+  /**
+   * Move the residual values cached by a thread into the colored assembly buffers.  Only valid while
+   * a colored residual is being assembled.
+   */
+  void addCachedResidualColored(THREAD_ID tid);
+
   /**
    * Indicated whether this system needs material properties on boundaries.
    * @return Boolean if IntegratedBCs are active
@@ -411,6 +443,18 @@ public:
   void updateActiveDGKernels(Real t, Real dt, THREAD_ID tid);
   //@}
 
+  /**
+   * Get the variables that the active kernels, integrated BCs and DG kernels on a subdomain depend on.  Only
+   * the integrated BCs that should be applied (see BoundaryCondition::shouldApply()) are considered.  The set is
+   * built the first time a subdomain is visited with a combination of BCs that apply and reused until the next
+   * time step.
+   * Must be called after updateActiveKernels() for the same subdomain.
+   * @param subdomain_id The subdomain
+   * @param tid The thread
+   * @return The set of MooseVariables needed on the subdomain
+   */
+  const std::set<MooseVariable *> & getActiveVariableDependencies(SubdomainID subdomain_id, THREAD_ID tid);
+
   //@{
   /**
    * Access functions to Warehouses from outside NonlinearSystem
@@ -446,6 +490,19 @@ protected:
    */
   void computeResidualInternal(Moose::KernelType type = Moose::KT_ALL);
 
+  /**
+   * Whether the colored assembly can be used for the current residual evaluation.  DG kernels, hanging
+   * node constraints and the displaced problem can put contributions on dofs of elements that do not
+   * share a node, so those fall back to the regular assembly.
+   */
+  bool canUseColoredAssembly();
+
+  /**
+   * Compute the contributions of the elements to the residual one color at a time
+   * @param type The type of kernels for which the residual is to be computed.
+   */
+  void computeResidualColored(Moose::KernelType type);
+
   /**
    * Enforces nodal boundary conditions
    * @param residual Residual where nodal BCs are enforced (input/output)
@@ -499,6 +556,11 @@ protected:
   /// Dampers for each thread
   std::vector<DamperWarehouse> _dampers;
 
+  /// Active integrated BCs on the boundaries of a subdomain for the current time step (for each thread)
+  std::vector<std::map<SubdomainID, std::vector<IntegratedBC *> > > _subdomain_integrated_bcs;
+  /// Variables needed by the active objects on a subdomain, keyed by the subdomain and which of its integrated BCs apply (for each thread)
+  std::vector<std::map<std::pair<SubdomainID, std::vector<bool> >, std::set<MooseVariable *> > > _active_var_dependencies;
+
   /// Decomposition splits
   SplitWarehouse _splits;
 
@@ -518,8 +580,25 @@ protected:
   /// Whether or not to use a finite differenced preconditioner
   bool _use_finite_differenced_preconditioner;
 #ifdef LIBMESH_HAVE_PETSC
+  /// Coloring of the finite differenced preconditioner, kept until the dof map changes
   MatFDColoring _fdcoloring;
+  /// Shell matrix applying the Jacobian by finite differences of the MOOSE residual
+  Mat _mf_operator;
 #endif
+  /// Whether _fdcoloring has been created
+  bool _have_fdcoloring;
+  /// Local rows of the Jacobian sparsity pattern, kept from augmentSparsity() until the next FDP coloring
+  SparsityPattern::Graph _fd_sparsity;
+  /// Whether the sparsity pattern and the matrix were rebuilt since _fdcoloring was created
+  bool _fd_sparsity_changed;
+  /// Linearization point of the MOOSE matrix-free operator
+  NumericVector<Number> * _mf_base_solution;
+  /// Residual at the linearization point
+  NumericVector<Number> * _mf_base_residual;
+  /// Work vector for the perturbed solution
+  NumericVector<Number> * _mf_perturbed_solution;
+  /// Norm of the linearization point (used for the differencing parameter)
+  Real _mf_base_solution_norm;
   /// Whether or not the system can be decomposed into splits
   bool _have_decomposition;
   /// Name of the top-level split of the decomposition
@@ -546,6 +625,13 @@ protected:
   /// true if DG is active (optimization reasons)
   bool _doing_dg;
 
+  /// true if the residual is assembled one element color at a time
+  bool _use_colored_assembly;
+  /// Residual values of the local dofs accumulated by the colored assembly (TIME and NONTIME)
+  std::vector<std::vector<Number> > _colored_residual;
+  /// The local dofs, in the order of the _colored_residual entries
+  std::vector<dof_id_type> _colored_dof_indices;
+
   /// NumericVectors that will be zeroed before a residual computation
   std::vector<NumericVector<Number> *> _vecs_to_zero_for_residual;
 
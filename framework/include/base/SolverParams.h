@@ -24,6 +24,8 @@ public:
 
   Moose::SolveType _type;
   Moose::LineSearchType _line_search;
+  /// Whether the Jacobian action of (P)JFNK is applied by MOOSE instead of PETSc's MFFD matrix
+  bool _moose_matrix_free;
 };
 
 #endif /* SOLVERPARAMS_H_ */
@@ -83,6 +83,14 @@ public:
    */
   void activeIntegrated(BoundaryID boundary_id, std::vector<IntegratedBC *> & active_integrated) const;
 
+  /**
+   * Get active integrated boundary conditions.  The list for a boundary is built the first time it is
+   * requested and reused until the next time step, so it can be queried for every boundary side.
+   * @param boundary_id Boundary ID
+   * @return The active integrated bcs on the boundary
+   */
+  const std::vector<IntegratedBC *> & activeIntegrated(BoundaryID boundary_id) const;
+
   /**
    * Get active nodal boundary conditions
    * @param boundary_id Boundary ID
@@ -110,6 +118,9 @@ protected:
   std::map<BoundaryID, std::vector<NodalBC *> > _nodal_bcs;
   /// presetting nodal boundary condition on a boundary
   std::map<BoundaryID, std::vector<PresetNodalBC *> > _preset_nodal_bcs;
+
+  /// active integrated boundary conditions on a boundary for the current time step (built on demand)
+  mutable std::map<BoundaryID, std::vector<IntegratedBC *> > _active_integrated;
 };
 
 #endif // BCWAREHOUSE_H
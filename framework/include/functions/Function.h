@@ -69,6 +69,15 @@ public:
    */
   virtual Real value(Real t, const Point & p);
 
+  /**
+   * Evaluate the scalar function at many points at once, by default this calls value()
+   * for every point.  Override it when the function can share work between the points.
+   * \param t The time
+   * \param p The Points in space (x,y,z)
+   * \param values The values of the function at the points (resized to match p)
+   */
+  virtual void values(Real t, const std::vector<Point> & p, std::vector<Real> & values);
+
   /**
    * Override this to evaluate the vector function at a point (t,x,y,z), by default
    * this returns a zero vector, you must override it.
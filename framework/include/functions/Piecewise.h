@@ -37,6 +37,8 @@ protected:
   LinearInterpolation * _linear_interp;
   int _axis;
   bool _has_axis;
+  /// The interval of _linear_interp used by the last evaluation (Functions are per thread)
+  unsigned int _interval_hint;
 private:
   const std::string _data_file_name;
   bool parseNextLineReals( std::ifstream & ifs, std::vector<Real> & myvec);
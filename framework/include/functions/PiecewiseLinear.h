@@ -36,6 +36,12 @@ public:
    */
   virtual Real value(Real t, const Point & pt);
 
+  /**
+   * Get the values of the function at many points, the function is sampled only once
+   * when it depends on time only
+   */
+  virtual void values(Real t, const std::vector<Point> & p, std::vector<Real> & values);
+
   /**
    * Get the time derivative of the function (based on time only)
    * \param t The time
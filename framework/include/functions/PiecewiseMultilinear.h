@@ -47,6 +47,12 @@ public:
    */
   virtual Real value(Real t, const Point & pt);
 
+  /**
+   * Given t and many points, return the interpolated values.  The grid is sampled only once
+   * when no axis is a spatial direction.
+   */
+  virtual void values(Real t, const std::vector<Point> & p, std::vector<Real> & values);
+
 private:
 
   /// object to provide function evaluations at points on the grid
@@ -66,6 +72,22 @@ private:
   /// the grid
   std::vector<std::vector<Real> > _grid;
 
+  /// true if one of the axes is a spatial direction
+  bool _has_space_axis;
+
+  /// the grid interval used by the last evaluation along each axis (Functions are per thread)
+  std::vector<unsigned int> _hints;
+
+  ///@{ scratch storage for sample()
+  std::vector<Real> _pt_in_grid;
+  std::vector<unsigned int> _left;
+  std::vector<unsigned int> _right;
+  std::vector<unsigned int> _arg;
+  ///@}
+
+  /// convert t and p to a point in the grid, stored in _pt_in_grid
+  void toGrid(Real t, const Point & p);
+
   /**
    * This does the core work.  Given a point, pt, defined
    * on the grid (not the MOOSE simulation reference frame),
@@ -78,13 +100,15 @@ private:
    * Finds lower_x and upper_x which satisfy in_arr[lower_x] < x <= in_arr[upper_x].
    * End conditions: if x<in_arr[0] then lower_x = 0 = upper_x is returned
    *                 if x>in_arr[N-1] then lower_x = N-1 = upper_x is returned (N=size of in_arr)
+   * The bracket given by hint (and the next one) is checked before doing a binary search.
    *
    * @param in_arr The monotonically increasing vector of real numbers
    * @param x The real value for which we want the neighbor indices
    * @param lower_x Upon return will contain lower_x specified above
    * @param upper_x Upon return will contain upper_x specified above
+   * @param hint The upper_x of the previous call, updated with the new upper_x
    */
-  void getNeighborIndices(std::vector<Real> in_arr, Real x, unsigned int & lower_x, unsigned int & upper_x);
+  void getNeighborIndices(const std::vector<Real> & in_arr, Real x, unsigned int & lower_x, unsigned int & upper_x, unsigned int & hint);
 };
 
 #endif //PIECEWISEMULTILINEAR_H
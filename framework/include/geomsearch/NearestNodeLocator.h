@@ -19,6 +19,7 @@
 #include "MooseMesh.h"
 #include "libmesh/vector_value.h"
 #include "Restartable.h"
+#include "KDTree.h"
 
 // libMesh
 #include "libmesh/libmesh_common.h"
@@ -86,6 +87,11 @@ public:
   };
 
 protected:
+  /**
+   * Rebuild _master_tree from the current positions of _master_nodes.
+   */
+  void buildMasterTree();
+
   SubProblem & _subproblem;
 
   MooseMesh & _mesh;
@@ -106,8 +112,18 @@ public:
   // The following parameter controls the patch size that is searched for each nearest neighbor
   static const unsigned int _patch_size;
 
-  // The furthest through the patch that had to be searched for any node last time
+  // The furthest through the patch that had to be searched for any node last time (1 if the tree found a patch to be stale)
   Real _max_patch_percentage;
+
+protected:
+  /// Whether the patches are built from and checked against a tree over all of the master nodes
+  bool _use_tree;
+
+  /// The master nodes considered by this processor (only kept when _use_tree is true)
+  std::vector<dof_id_type> _master_nodes;
+
+  /// Tree over the current positions of _master_nodes, rebuilt by every findNodes()
+  KDTree _master_tree;
 };
 
 #endif //NEARESTNODELOCATOR_H
@@ -17,11 +17,15 @@
 
 #include "NearestNodeLocator.h"
 
+class KDTree;
+
 class NearestNodeThread
 {
 public:
   NearestNodeThread(const MooseMesh & mesh,
-                    std::map<dof_id_type, std::vector<dof_id_type> > & neighbor_nodes);
+                    std::map<dof_id_type, std::vector<dof_id_type> > & neighbor_nodes,
+                    const KDTree * master_tree = NULL,
+                    const std::vector<dof_id_type> * master_nodes = NULL);
 
   // Splitting Constructor
   NearestNodeThread(NearestNodeThread & x, Threads::split split);
@@ -42,6 +46,12 @@ protected:
 
   // The neighborhood nodes associated with each node
   std::map<dof_id_type, std::vector<dof_id_type> > & _neighbor_nodes;
+
+  // Tree over the positions of all the master nodes, only used to tell if a patch is stale
+  const KDTree * _master_tree;
+
+  // The master node ids corresponding to the points of _master_tree
+  const std::vector<dof_id_type> * _master_nodes;
 };
 
 #endif //NEARESTNODETHREAD_H
@@ -87,6 +87,19 @@ public:
   void setNormalSmoothingMethod(std::string nsmString);
   Real getTangentialTolerance() {return _tangential_tolerance;}
   void skipOffProcessSlaveNodes( bool skip_them = true );
+  void setIncrementalSearch(bool incremental_search);
+
+  ///@{
+  /**
+   * How the slave nodes were found, summed over all the detectPenetration() calls so far: on the
+   * face they were on before, on a face next to it (incremental search only), or by the full
+   * search around their nearest master node.  The NumPenetrationSearchNodes postprocessor
+   * reports them.
+   */
+  unsigned long int numPreviousFaceNodes() const { return _n_previous_face; }
+  unsigned long int numNeighborFaceNodes() const { return _n_neighbor_face; }
+  unsigned long int numFullSearchNodes() const { return _n_full_search; }
+  ///@}
 
 protected:
   /// Check whether found candidates are reasonable
@@ -97,6 +110,12 @@ protected:
   Real _normal_smoothing_distance; // Distance from edge (in parametric coords) within which to perform normal smoothing
   NORMAL_SMOOTHING_METHOD _normal_smoothing_method;
   bool _skip_off_process_slaves; // Do not PenetrationInfos for nodes that are not locally owned.
+  bool _incremental_search; // Try the faces next to the previous contact face before the full search
+
+  // Search counters summed over the detectPenetration() calls (local to this processor)
+  unsigned long int _n_previous_face;
+  unsigned long int _n_neighbor_face;
+  unsigned long int _n_full_search;
 };
 
 /**
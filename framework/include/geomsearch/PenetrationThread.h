@@ -41,7 +41,8 @@ public:
                     std::vector<dof_id_type> & elem_list,
                     std::vector<unsigned short int> & side_list,
                     std::vector<boundary_id_type> & id_list,
-                    bool skip_off_process_slaves);
+                    bool skip_off_process_slaves,
+                    bool incremental_search = false);
 
   // Splitting Constructor
   PenetrationThread(PenetrationThread & x, Threads::split split);
@@ -50,6 +51,15 @@ public:
 
   void join(const PenetrationThread & other);
 
+  /// Number of slave nodes that stayed on the face they were on last time
+  unsigned int _n_previous_face;
+
+  /// Number of slave nodes found on a face next to the one they were on last time (incremental search only)
+  unsigned int _n_neighbor_face;
+
+  /// Number of slave nodes that needed the full search around their nearest master node
+  unsigned int _n_full_search;
+
 protected:
   SubProblem & _subproblem;
   // The Mesh
@@ -84,6 +94,7 @@ protected:
   unsigned int _n_elems;
   THREAD_ID _tid;
   bool _skip_off_process_slaves;
+  bool _incremental_search;
 
   enum CompeteInteractionResult
   {
@@ -179,6 +190,17 @@ protected:
   getSidesOnMasterBoundary(std::vector<unsigned int> &sides,
                            const Elem *const elem);
 
+  /**
+   * Look for the slave node on the master faces sharing a node with the face of info.
+   * Only a face the node projects inside of is accepted, everything else (edges, ridges,
+   * several candidate faces) is left to the full search.
+   *
+   * @return true if info was replaced with the face that was found
+   */
+  bool
+  findContactOnNeighborFaces(const Node & node,
+                             PenetrationInfo * & info);
+
   void
   computeSlip( FEBase & fe,
                PenetrationInfo & info );
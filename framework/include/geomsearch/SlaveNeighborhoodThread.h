@@ -22,13 +22,16 @@
 // System
 #include <set>
 
+class KDTree;
+
 class SlaveNeighborhoodThread
 {
 public:
   SlaveNeighborhoodThread(const MooseMesh & mesh,
                           const std::vector<dof_id_type> & trial_master_nodes,
                           std::map<dof_id_type, std::vector<dof_id_type> > & node_to_elem_map,
-                          const unsigned int patch_size);
+                          const unsigned int patch_size,
+                          const KDTree * master_tree = NULL);
 
 
   /// Splitting Constructor
@@ -59,6 +62,9 @@ protected:
 
   /// The number of nodes to keep
   unsigned int _patch_size;
+
+  /// Tree over the positions of _trial_master_nodes (optional, the patches are found by brute force without it)
+  const KDTree * _master_tree;
 };
 
 #endif //SLAVENEIGHBORHOODTHREAD_H
@@ -33,8 +33,16 @@ public:
 protected:
   virtual Real computeQpResidual();
 
+  // Batched version of the above, the function is evaluated at all quadrature points at once
+  virtual bool useBatchedAssembly() const;
+  virtual void computeBatchResidual(DenseVector<Number> & local_re);
+  virtual void computeBatchJacobian(DenseMatrix<Number> & local_ke);
+
   Real _value;
   Function & _function;
+
+  /// The quadrature points passed to Function::values()
+  std::vector<Point> _batch_points;
 };
 
 #endif
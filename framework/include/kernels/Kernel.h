@@ -49,6 +49,43 @@ protected:
   /// This callback is used for Kernels that need to perturb residual calculations
   virtual void precalculateResidual();
 
+  /**
+   * Whether the local residual and Jacobian blocks are computed by computeBatchResidual() and
+   * computeBatchJacobian() rather than by one virtual call per test function and quadrature point.
+   * Kernels implementing the batched methods must return false when a derived class may have
+   * overridden the per-qp methods.
+   */
+  virtual bool useBatchedAssembly() const;
+
+  /**
+   * Add this Kernel's contribution for all test functions and quadrature points to local_re.  The
+   * default calls computeQpResidual() for every test function and quadrature point.
+   */
+  virtual void computeBatchResidual(DenseVector<Number> & local_re);
+
+  /**
+   * Add this Kernel's contribution for all test/shape functions and quadrature points to local_ke.  The
+   * default calls computeQpJacobian() for every test function, shape function and quadrature point.
+   */
+  virtual void computeBatchJacobian(DenseMatrix<Number> & local_ke);
+
+  /// Add the local residual block through the batched method if it is used, through the per-qp loop otherwise
+  void computeLocalResidual(DenseVector<Number> & local_re);
+
+  /// Add the local Jacobian block through the batched method if it is used, through the per-qp loop otherwise
+  void computeLocalJacobian(DenseMatrix<Number> & local_ke);
+
+  /// Compute _JxW * _coord on the current element into a contiguous array
+  const std::vector<Real> & batchWeights();
+
+  /**
+   * Copy the gradients of the test or shape functions into one contiguous array per function and component
+   * (structure of arrays), indexing: [(i * LIBMESH_DIM + component) * n_qp + qp]
+   * @param grads The gradients, indexing: [i][qp]
+   * @param soa The array to fill
+   */
+  void batchGradients(const VariablePhiGradient & grads, std::vector<Real> & soa);
+
   /// Holds the solution at current quadrature points
   VariableValue & _u;
 
@@ -60,6 +97,24 @@ protected:
 
   /// Derivative of u_dot with respect to u
   VariableValue & _du_dot_du;
+
+  /// Whether the batched methods are used by the kernels that implement them
+  bool _batched_assembly;
+
+  /// _JxW * _coord at the quadrature points (see batchWeights())
+  std::vector<Real> _batch_JxW;
+
+  ///@{
+  /// Scratch storage for the batched methods, indexing: [qp] for values, [component * n_qp + qp] for gradients
+  std::vector<Real> _batch_value;
+  std::vector<Real> _batch_grad;
+  ///@}
+
+  ///@{
+  /// Test and shape function gradients in structure of arrays layout (see batchGradients())
+  std::vector<Real> _batch_grad_test;
+  std::vector<Real> _batch_grad_phi;
+  ///@}
 };
 
 #endif /* KERNEL_H */
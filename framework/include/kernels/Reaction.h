@@ -32,5 +32,9 @@ protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
 
+  // Batched versions of the above, only used when this is the most derived class
+  virtual bool useBatchedAssembly() const;
+  virtual void computeBatchResidual(DenseVector<Number> & local_re);
+  virtual void computeBatchJacobian(DenseMatrix<Number> & local_ke);
 };
 #endif //REACTION_H
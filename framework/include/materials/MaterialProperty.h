@@ -81,6 +81,22 @@ public:
    */
   virtual void qpCopy (const unsigned int to_qp, PropertyValue *rhs, const unsigned int from_qp) = 0;
 
+  /**
+   * Make this Property operate on n_qpoints values stored in another Property starting at 'offset'.
+   * The memory owned by this Property is set aside until arenaSwapBack() is called.
+   *
+   * @param arena The Property that owns the values
+   * @param offset The index of the first value in the arena
+   * @param n_qpoints The number of values this Property will see
+   */
+  virtual void arenaSwap (PropertyValue *arena, const unsigned int offset, const unsigned int n_qpoints) = 0;
+
+  /**
+   * Give this Property its own memory back after a call to arenaSwap().  Does nothing if this Property
+   * is not looking at an arena.
+   */
+  virtual void arenaSwapBack () = 0;
+
   // save/restore in a file
   virtual void store(std::ostream & stream) = 0;
   virtual void load(std::istream & stream) = 0;
@@ -110,11 +126,15 @@ class MaterialProperty : public PropertyValue
 {
 public:
   /// Explicitly declare a public constructor because we made the copy constructor private
-  MaterialProperty() : PropertyValue() { /* */ }
+  MaterialProperty() : PropertyValue(), _in_arena(false) { /* */ }
 
   virtual ~MaterialProperty()
   {
-    _value.release();
+    // Never free the memory of an arena we are looking at
+    if (_in_arena)
+      _own_value.release();
+    else
+      _value.release();
   }
 
   /**
@@ -168,6 +188,16 @@ public:
    */
   virtual void qpCopy (const unsigned int to_qp, PropertyValue *rhs, const unsigned int from_qp);
 
+  /**
+   * Look at n_qpoints values stored in 'arena' starting at 'offset'
+   */
+  virtual void arenaSwap (PropertyValue *arena, const unsigned int offset, const unsigned int n_qpoints);
+
+  /**
+   * Stop looking at the arena and get our own values back
+   */
+  virtual void arenaSwapBack ();
+
   /**
    * Store the property into a binary stream
    */
@@ -206,6 +236,12 @@ private:
 
   /// Stored parameter value.
   MooseArray<T> _value;
+
+  /// Our own memory while _value is looking at an arena
+  MooseArray<T> _own_value;
+
+  /// true if _value is looking at an arena (see arenaSwap())
+  bool _in_arena;
 };
 
 
@@ -248,6 +284,33 @@ MaterialProperty<T>::qpCopy (const unsigned int to_qp, PropertyValue *rhs, const
   _value[to_qp] = cast_ptr<const MaterialProperty<T>*>(rhs)->_value[from_qp];
 }
 
+template <typename T>
+inline void
+MaterialProperty<T>::arenaSwap (PropertyValue *arena, const unsigned int offset, const unsigned int n_qpoints)
+{
+  mooseAssert(arena != NULL, "Swapping with a NULL arena?");
+  mooseAssert(!_in_arena, "Property is already looking at an arena");
+
+  MaterialProperty<T> * arena_prop = cast_ptr<MaterialProperty<T>*>(arena);
+  mooseAssert(offset + n_qpoints <= arena_prop->_value.size(), "Arena access out of bounds");
+
+  _own_value.swap(_value);
+  _value.shallowCopy(&arena_prop->_value[offset], n_qpoints);
+  _in_arena = true;
+}
+
+template <typename T>
+inline void
+MaterialProperty<T>::arenaSwapBack ()
+{
+  if (!_in_arena)
+    return;
+
+  _value.shallowCopy(_own_value);
+  _own_value.shallowCopy(MooseArray<T>());
+  _in_arena = false;
+}
+
 template<typename T>
 inline void
 MaterialProperty<T>::store(std::ostream & stream)
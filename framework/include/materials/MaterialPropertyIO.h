@@ -44,15 +44,55 @@ public:
   virtual ~MaterialPropertyIO();
 
   virtual void write(const std::string & file_name);
+
+  /**
+   * Read back the file this processor wrote.  The run has to use the same number of processors as the
+   * one that wrote the checkpoint, like the restartable data and the per processor solution files.
+   */
   virtual void read(const std::string & file_name);
 
+  /**
+   * Write the stateful material properties to a stream, in the format of the files written above.
+   * The stream has to be seekable.
+   */
+  void write(std::ostream & out);
+
+  /**
+   * The name of the file written for this processor.
+   */
+  std::string fileName(const std::string & file_name) const;
+
 protected:
   FEProblem & _fe_problem;
   MooseMesh & _mesh;
   MaterialPropertyStorage & _material_props;
   MaterialPropertyStorage & _bnd_material_props;
 
+  /**
+   * Load the data of the elements present in the mesh from one file
+   * @param file_name The name of the file
+   */
+  void readFile(const std::string & file_name);
+
+  /**
+   * Write the index table (element ids and data offsets, plus the end of the data)
+   */
+  void writeIndex(std::ostream & out, std::vector<dof_id_type> & ids, std::vector<std::streamoff> & offsets);
+
+  /**
+   * The number of states stored per element for a storage (0 if there are no stateful properties)
+   */
+  unsigned int numStates(const MaterialPropertyStorage & storage) const;
+
+  /**
+   * The name of the file written by processor proc_id.
+   */
+  std::string fileName(const std::string & file_name, processor_id_type proc_id) const;
+
   static const unsigned int file_version;
+
+  /// The size of the file buffers
+  static const std::size_t _buffer_size;
 };
 
 #endif /* MATERIALPROPERTYIO_H */
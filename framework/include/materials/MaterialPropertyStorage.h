@@ -25,10 +25,12 @@
 
 #include <vector>
 #include <map>
+#include <set>
 #include <string>
 
 class Material;
 class MaterialData;
+class MooseMesh;
 class QpMap;
 
 /**
@@ -121,7 +123,7 @@ public:
 
   /**
    * Copy material properties from elem_from to elem_to
-   * Thread safe
+   * Thread safe, unless the read-only index is in place and elem_to has no storage yet (elem_to is added to the index then)
    * @param material_data MaterialData object to work with
    * @param elem_to Element to copy data to
    * @param elem_from Element to copy data from
@@ -131,7 +133,7 @@ public:
 
   /**
    * Swap (shallow copy) material properties in MaterialData and MaterialPropertyStorage
-   * Thread safe
+   * Thread safe (without locking for the contiguous storage)
    * @param material_data MaterialData object to work with
    * @param elem Element id
    * @param side Side number (elemental material properties have this equal to zero)
@@ -147,6 +149,46 @@ public:
    */
   void swapBack(MaterialData & material_data, const Elem & elem, unsigned int side);
 
+  /**
+   * Give the active local elements of the mesh (and the elements the stateful properties are about to be projected
+   * onto) their entries in the local element index of the contiguous storage.  Storage can be created for those
+   * from the threaded loops since the index does not have to grow then.  The entries of the elements that are not
+   * active anymore are kept, they are needed for the projection.  Does nothing for the per-element HashMaps.
+   * Not thread safe.
+   * @param mesh The mesh (after adaptivity)
+   */
+  void indexLocalElems(MooseMesh & mesh);
+
+  /**
+   * Free the values of the elements that are no longer active in the mesh (children removed by coarsening and
+   * parents of refined elements) and rebuild the local element index of the contiguous storage.  The released
+   * slots are handed out again before the storage grows.  Call this once the stateful properties have been
+   * projected onto the new mesh.  Does nothing for the per-element HashMaps.  Not thread safe.
+   * @param mesh The mesh after adaptivity
+   */
+  void releaseRemovedElems(MooseMesh & mesh);
+
+  /**
+   * Build an element index for swap() and swapBack() that can be used without taking any locks.  Call this once
+   * the storage for all elements has been created (i.e. after the initial setup and after mesh adaptivity).
+   * Only the active local elements of the mesh are indexed, the others are still handled (with locking).  The index
+   * stays in place until clearReadOnlyIndex() is called, which has to happen before elements are removed or storage
+   * is created for new ones: initializing and projecting stateful properties is an error while the index is in place.
+   * Not thread safe.
+   * @param mesh The mesh the stateful properties live on
+   */
+  void buildReadOnlyIndex(MooseMesh & mesh);
+
+  /**
+   * Remove the index built by buildReadOnlyIndex() and go back to the locked lookups.  Not thread safe.
+   */
+  void clearReadOnlyIndex();
+
+  /**
+   * @return true if swap() and swapBack() use the index built by buildReadOnlyIndex()
+   */
+  bool hasReadOnlyIndex() const { return _read_only_index; }
+
   /**
    * @return a Boolean indicating whether stateful properties exist on this material
    */
@@ -157,6 +199,41 @@ public:
    */
   bool hasOlderProperties() const { return _has_older_prop; }
 
+  /**
+   * Switch to the contiguous storage: every stateful property gets one large array per state (current, old, older)
+   * and each element/side owns a range of quadrature points inside of it.  This has to be called before any
+   * stateful data is stored.
+   * @param state true to use the contiguous storage, false to use the per-element HashMaps
+   */
+  void useArena(bool state);
+
+  /**
+   * @return true if the stateful properties are kept in the contiguous storage (see useArena())
+   */
+  bool usesArena() const { return _use_arena; }
+
+  /**
+   * Add the IDs of the elements that have stateful values stored to elem_ids
+   */
+  void storedElemIds(std::set<dof_id_type> & elem_ids);
+
+  /**
+   * Store the stateful values of all sides of one element.  The layout is the same as the one of
+   * an entry of props(), for both kinds of storage.
+   * @param stream The stream to write into
+   * @param elem The element, nothing but an empty entry is written if it has no values stored
+   * @param state 0 for current, 1 for old and 2 for older values
+   */
+  void storeElem(std::ostream & stream, const Elem & elem, unsigned int state);
+
+  /**
+   * Load the stateful values of one element written by storeElem()
+   * @param stream The stream to read from
+   * @param elem The element
+   * @param state 0 for current, 1 for old and 2 for older values
+   */
+  void loadElem(std::istream & stream, const Elem & elem, unsigned int state);
+
   HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & props() { return *_props_elem; }
   HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & propsOld() { return *_props_elem_old; }
   HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & propsOlder() { return *_props_elem_older; }
@@ -177,6 +254,154 @@ protected:
   HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > * _props_elem_old;
   HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > * _props_elem_older;
 
+  /**
+   * Location of the stateful values of one element (side) inside the contiguous storage
+   */
+  struct ArenaSlot
+  {
+    ArenaSlot() : _chunk(0), _offset(0), _n_qpoints(0) {}
+
+    /// The chunk holding the values
+    unsigned int _chunk;
+    /// Index of the first quadrature point inside the chunk
+    unsigned int _offset;
+    /// Number of quadrature points (0 if the element side has no values stored)
+    unsigned int _n_qpoints;
+  };
+
+  /// true if the stateful properties are kept in the contiguous storage
+  bool _use_arena;
+
+  ///@{
+  /// The contiguous storage, indexing: [chunk][stateful_prop_id] -> values of all slots living in that chunk
+  std::vector<MaterialProperties> * _arena;
+  std::vector<MaterialProperties> * _arena_old;
+  std::vector<MaterialProperties> * _arena_older;
+  ///@}
+
+  /// Number of quadrature points each chunk can hold
+  std::vector<unsigned int> _chunk_capacity;
+  /// Number of quadrature points already handed out in each chunk
+  std::vector<unsigned int> _chunk_used;
+
+  /// [_side_begin[local index] + side] -> slot of the element side in the contiguous storage
+  std::vector<ArenaSlot> _side_slots;
+  /// Number of quadrature points -> slots released by removed elements
+  std::map<unsigned int, std::vector<ArenaSlot> > _free_slots;
+
+  /// true if swap() and swapBack() use the read-only index (see buildReadOnlyIndex())
+  bool _read_only_index;
+
+  /// Number of element IDs covered by one page of _local_index
+  static const unsigned int _local_index_page_size;
+
+  /**
+   * Local element index, indexing: [elem_id / page size][elem_id % page size] -> local index of the element (or
+   * invalid_uint).  Pages are only allocated for the ID ranges holding indexed elements, so the memory follows the
+   * elements of the local partition and not the largest element ID.
+   */
+  std::vector<std::vector<unsigned int> > _local_index;
+  /// [local index] -> element ID
+  std::vector<dof_id_type> _local_elem_ids;
+  /// [local index] -> first entry of the element ([local index + 1] is one past its last entry), one entry per side
+  std::vector<unsigned int> _side_begin;
+
+  ///@{
+  /// Read-only index, indexing: [_side_begin[local index] + side] -> stored properties (or NULL)
+  std::vector<MaterialProperties *> * _index;
+  std::vector<MaterialProperties *> * _index_old;
+  std::vector<MaterialProperties *> * _index_older;
+  ///@}
+
+  /// Size of the first chunk (in quadrature points), every following chunk doubles in size
+  static const unsigned int _min_chunk_size;
+  /// Upper limit of the chunk size (in quadrature points)
+  static const unsigned int _max_chunk_size;
+  /// Upper limit of the number of chunks, the chunk lists are never reallocated
+  static const unsigned int _max_n_chunks;
+
+  /**
+   * Find the slot of an element (side)
+   * @param elem_id ID of the element
+   * @param side Side of the element (0 for volumetric material properties)
+   * @return The slot or NULL if there are no stateful values stored for this element (side)
+   */
+  const ArenaSlot * arenaSlot(dof_id_type elem_id, unsigned int side) const;
+
+  /**
+   * Find the slot of an element (side) and create it if it does not exist yet.  Not thread safe, and the element
+   * has to be in the local element index already when this is called from the threaded loops.
+   * @param material_data MaterialData object holding properties of the right types
+   * @param elem Element we are on
+   * @param side Side of the element 'elem' (0 for volumetric material properties)
+   * @param n_qpoints Number of quadrature points
+   * @return The slot (by value since the slot list can grow)
+   */
+  ArenaSlot allocArenaSlot(MaterialData & material_data, const Elem & elem, unsigned int side, unsigned int n_qpoints);
+
+  /**
+   * Rebuild the local element index of the contiguous storage for the active local elements of the mesh.  The
+   * slots of the elements that are dropped from the index go onto the free lists.  Not thread safe.
+   * @param mesh The mesh
+   * @param keep_inactive true to keep the elements that are not active anymore and to add the elements the stateful
+   *                      properties are going to be projected onto
+   */
+  void rebuildArenaIndex(MooseMesh & mesh, bool keep_inactive);
+
+  /**
+   * Point the properties in material_data at the contiguous storage of an element (side)
+   */
+  void swapArena(MaterialData & material_data, const Elem & elem, unsigned int side);
+
+  /**
+   * @return true if the storage of an element (side) already exists and is in the read-only index
+   */
+  bool isIndexed(const Elem & elem, unsigned int side, unsigned int n_qpoints);
+
+  /**
+   * @return The local index of an element or invalid_uint if the element is not indexed
+   */
+  unsigned int localIndex(dof_id_type elem_id) const;
+
+  /**
+   * Add an element to the local index, an element that is in there already gets a new local index.  Not thread safe.
+   * @param elem_id ID of the element
+   * @param n_entries Number of entries (sides) of the element
+   * @return The local index of the element
+   */
+  unsigned int addLocalElem(dof_id_type elem_id, unsigned int n_entries);
+
+  /**
+   * Point the read-only index at the stored properties of all sides of an element.  Not thread safe.
+   */
+  void indexElem(const Elem & elem);
+
+  /**
+   * Find an element (side) in one of the read-only indices
+   * @return The stored properties or NULL if the element (side) is not in the index
+   */
+  MaterialProperties * indexLookup(std::vector<MaterialProperties *> & index, dof_id_type elem_id, unsigned int side);
+
+  /**
+   * @return The contiguous storage for a state (0 for current, 1 for old and 2 for older values)
+   */
+  std::vector<MaterialProperties> & arenaState(unsigned int state);
+
+  /**
+   * @return The per-element HashMap for a state (0 for current, 1 for old and 2 for older values)
+   */
+  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & propsState(unsigned int state);
+
+  /**
+   * Store the stored sides of an element held in the contiguous storage (see storeElem())
+   */
+  void storeArenaElem(std::ostream & stream, dof_id_type elem_id, std::vector<MaterialProperties> & arena);
+
+  /**
+   * Load the values of one side of an element into the contiguous storage, the side number has already been read
+   */
+  void loadArenaSide(std::istream & stream, dof_id_type elem_id, unsigned int side, std::vector<MaterialProperties> & arena);
+
   /// mapping from property name to property ID
   /// NOTE: this is static so the property numbering is global within the simulation (not just FEProblem - should be useful when we will use material properties from
   /// one FEPRoblem in another one - if we will ever do it)
@@ -211,6 +211,12 @@ public:
   bool changed() const;
   void changed(bool state);
 
+  /**
+   * The number of times meshChanged() has been called.  Objects caching data that depends
+   * on the mesh can store this and compare against it to know when to rebuild.
+   */
+  unsigned int changeCount() const;
+
   /**
    * Setter/getter for the _is_prepared flag.
    */
@@ -283,6 +289,13 @@ public:
   StoredRange<MooseMesh::const_bnd_node_iterator, const BndNode*> * getBoundaryNodeRange();
   StoredRange<MooseMesh::const_bnd_elem_iterator, const BndElement*> * getBoundaryElementRange();
 
+  /**
+   * Return the active local elements split into one range per color.  Elements of the same color do
+   * not share any node, so they can be assembled concurrently without touching the same dofs.  The
+   * (greedy) coloring is built on the first call and rebuilt after the mesh changes.
+   */
+  const std::vector<ConstElemRange *> & getColoredActiveLocalElementRanges();
+
   /**
    * Returns a read-only reference to the set of subdomains currently
    * present in the Mesh.
@@ -376,6 +389,16 @@ public:
    */
   const MooseEnum & getPatchUpdateStrategy();
 
+  /**
+   * Get the way the nearest node locators search for the nearest master node (patch or tree).
+   */
+  const MooseEnum & getNearestNodeSearch() const;
+
+  /**
+   * Whether the penetration locators try the faces next to the previous contact face before the full search.
+   */
+  bool getIncrementalPenetrationSearch() const;
+
   /**
    * Implicit conversion operator from MooseMesh -> libMesh::MeshBase.
    */
@@ -724,6 +747,9 @@ protected:
   /// true if mesh is changed (i.e. after adaptivity step)
   bool _is_changed;
 
+  /// The number of calls to meshChanged()
+  unsigned int _change_count;
+
   /// True if a Nemesis Mesh was read in
   bool _is_nemesis;
 
@@ -747,6 +773,10 @@ protected:
    * to get rebuilt all the time (which takes time).
    */
   ConstElemRange * _active_local_elem_range;
+  /// Active local elements grouped by color (the ranges below point into these)
+  std::vector<std::vector<const Elem *> > _colored_elems;
+  /// One range per color of active local elements
+  std::vector<ConstElemRange *> _colored_elem_ranges;
   /// active local + active ghosted
   SemiLocalNodeRange * _active_semilocal_node_range;
   NodeRange * _active_node_range;
@@ -809,6 +839,12 @@ protected:
   /// The patch update strategy
   MooseEnum _patch_update_strategy;
 
+  /// How the nearest node locators search for the nearest master node
+  MooseEnum _nearest_node_search;
+
+  /// Whether the penetration locators try the faces next to the previous contact face before the full search
+  bool _incremental_penetration_search;
+
   /// file_name iff this mesh was read from a file
   std::string _file_name;
 
@@ -25,6 +25,10 @@
 
 #include <deque>
 
+#ifdef LIBMESH_HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 // Forward declarations
 class Checkpoint;
 struct CheckpointFileNames;
@@ -90,7 +94,30 @@ protected:
 
   void updateCheckpointFiles(CheckpointFileNames file_struct);
 
+  /**
+   * Start writing the snapshot in _async_files (and removing _async_removed_files) in the
+   * background.  Without pthreads the files are written right away.
+   */
+  void startAsyncWrite();
+
+  /**
+   * Wait for the background thread started by the last checkpoint to finish.
+   */
+  void waitForAsyncWrite();
+
 private:
+  /// Entry point of the background thread
+  static void * asyncWriteThread(void * checkpoint);
+
+  /**
+   * Write the files in _async_files (to temporary names that are renamed once all of them are written)
+   * and then remove the ones in _async_removed_files
+   */
+  void writeAsyncFiles();
+
+  /// Warn about the errors of the last background write
+  void reportAsyncErrors();
+
 
   /// Max no. of output files to store
   unsigned int _num_files;
@@ -121,6 +148,26 @@ private:
 
   /// Vector of checkpoint filename structures
   std::deque<CheckpointFileNames> _file_names;
+
+  /// True if the restartable data and material property files are written in the background
+  bool _async;
+
+  /// True while a background write is in progress
+  bool _async_running;
+
+#ifdef LIBMESH_HAVE_PTHREAD
+  /// The thread doing the background write
+  pthread_t _async_thread;
+#endif
+
+  /// The names and contents of the files to write in the background
+  std::vector<std::pair<std::string, std::string> > _async_files;
+
+  /// The old checkpoint files to remove in the background
+  std::vector<std::string> _async_removed_files;
+
+  /// The errors from the background thread
+  std::vector<std::string> _async_errors;
 };
 
 #endif //CHECKPOINT_H
@@ -43,6 +43,7 @@ public:
   ElementExtremeValue(const std::string & name, InputParameters parameters);
   virtual void initialize();
   virtual Real getValue();
+  virtual void deferReductions(DeferredReductions & reductions);
   virtual void threadJoin(const UserObject & y);
 
 protected:
@@ -38,6 +38,7 @@ public:
   virtual void execute();
   virtual void threadJoin(const UserObject & y);
   virtual Real getValue();
+  virtual void deferReductions(DeferredReductions & reductions);
 
 protected:
   virtual Real computeQpIntegral() = 0;
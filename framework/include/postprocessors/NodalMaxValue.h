@@ -33,6 +33,7 @@ public:
   virtual void initialize();
   virtual void execute();
   virtual Real getValue();
+  virtual void deferReductions(DeferredReductions & reductions);
   virtual void threadJoin(const UserObject & y);
 
 protected:
@@ -36,6 +36,7 @@ public:
    * This will return the degrees of freedom in the system.
    */
   virtual Real getValue();
+  virtual void deferReductions(DeferredReductions & reductions);
 
   void threadJoin(const UserObject & y);
 
@@ -0,0 +1,55 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef NUMPENETRATIONSEARCHNODES_H
+#define NUMPENETRATIONSEARCHNODES_H
+
+#include "GeneralPostprocessor.h"
+#include "GeometricSearchInterface.h"
+
+//Forward Declarations
+class NumPenetrationSearchNodes;
+class PenetrationLocator;
+
+template<>
+InputParameters validParams<NumPenetrationSearchNodes>();
+
+/**
+ * Reports how many slave nodes the penetration searches so far found on their previous face, on a
+ * face next to it (incremental search), or with the full search around their nearest master node.
+ */
+class NumPenetrationSearchNodes :
+  public GeneralPostprocessor,
+  public GeometricSearchInterface
+{
+public:
+  NumPenetrationSearchNodes(const std::string & name, InputParameters parameters);
+
+  virtual void initialize() {}
+  virtual void execute() {}
+
+  /**
+   * Get the number of slave nodes found by the requested search
+   */
+  virtual Real getValue();
+
+protected:
+  /// The locator whose counters are reported
+  PenetrationLocator & _penetration_locator;
+
+  /// Which of the counters to report
+  MooseEnum _search;
+};
+
+#endif // NUMPENETRATIONSEARCHNODES_H
@@ -19,8 +19,10 @@
 
 #include <string>
 #include <list>
+#include <map>
 
 class RestartableDatas;
+class RestartableDataValue;
 
 class FEProblem;
 
@@ -41,6 +43,17 @@ public:
    */
   void writeRestartableData(std::string base_file_name, const RestartableDatas & restartable_datas, std::set<std::string> & _recoverable_data);
 
+  /**
+   * Write out the restartable data of one thread to a stream, in the format of the files
+   * written above.  The stream has to be seekable.
+   */
+  void writeRestartableData(std::ostream & out, const std::map<std::string, RestartableDataValue *> & restartable_data);
+
+  /**
+   * The name of the file holding the restartable data of thread tid on this processor.
+   */
+  std::string restartableDataFileName(const std::string & base_file_name, unsigned int tid) const;
+
   /**
    * Read restartable data header to verify that we are restarting on the correct number of processors and threads.
    */
@@ -52,6 +65,9 @@ public:
   void readRestartableData(RestartableDatas & restartable_datas, std::set<std::string> & _recoverable_data);
 
 private:
+  /// The size of the file buffer used when writing
+  static const std::size_t _write_buffer_size;
+
   /// Reference to a FEProblem being restarted
   FEProblem & _fe_problem;
 
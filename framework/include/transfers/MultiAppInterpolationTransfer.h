@@ -16,6 +16,13 @@
 #define MULTIAPPINTERPOLATIONTRANSFER_H
 
 #include "MultiAppTransfer.h"
+#include "KDTree.h"
+
+// libMesh forward declarations
+namespace libMesh
+{
+class MeshfreeInterpolation;
+}
 
 class MooseVariable;
 class MultiAppInterpolationTransfer;
@@ -48,6 +55,25 @@ protected:
    */
   Node * getNearestNode(const Point & p, Real & distance, const MeshBase::const_node_iterator & nodes_begin, const MeshBase::const_node_iterator & nodes_end);
 
+  /**
+   * Gather the source values from all of the processors.  With fixed_meshes, the first time
+   * through the source points are gathered as well and indexed to build the mappings.
+   */
+  void gatherSource(std::vector<Point> & src_pts, std::vector<Number> & src_vals);
+
+  /**
+   * Interpolate the source values to the point p.  With fixed_meshes the source indices and
+   * weights making up the value are also added to the mapping.
+   * @param idi The interpolation, only used without fixed_meshes
+   * @param src_vals The source values gathered from all of the processors (fixed_meshes only)
+   */
+  Real interpolate(MeshfreeInterpolation * idi, const std::vector<Number> & src_vals, const Point & p, dof_id_type to_dof, CachedMapping & mapping);
+
+  /**
+   * Set the target dofs of a cached mapping from the gathered source values.
+   */
+  void applyMapping(const CachedMapping & mapping, const std::vector<Number> & src_vals, NumericVector<Number> & to_solution);
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
 
@@ -55,6 +81,18 @@ protected:
   Real _power;
   MooseEnum _interp_type;
   Real _radius;
+
+  /// If true then the source points and weights feeding each target dof will be cached
+  bool _fixed_meshes;
+
+  /// True once the mappings have been built
+  bool _mappings_cached;
+
+  /// The gathered source points, only held while the mappings are built
+  KDTree _src_tree;
+
+  /// The cached mappings, indexed by the global app number (the master uses 0 for from_multiapp)
+  std::map<unsigned int, CachedMapping> _cached_mappings;
 };
 
 #endif /* MULTIAPPINTERPOLATIONTRANSFER_H */
@@ -17,6 +17,12 @@
 
 #include "MultiAppTransfer.h"
 
+// libMesh forward declarations
+namespace libMesh
+{
+class MeshFunction;
+}
+
 class MooseVariable;
 class MultiAppMeshFunctionTransfer;
 
@@ -39,9 +45,32 @@ public:
   virtual void execute();
 
 protected:
+  /**
+   * Evaluate the source variable at the point p.  With fixed_meshes the dofs and weights
+   * making up the value are also added to the mapping so the next transfers can skip the
+   * point location.
+   * @return The value or OutOfMeshValue if p is not in the source mesh
+   */
+  Real evaluate(MeshFunction & from_func, const System & from_sys, unsigned int from_var_num, const NumericVector<Number> & from_solution,
+                const Point & p, dof_id_type to_dof, CachedMapping & mapping);
+
+  /**
+   * Set the target dofs of a cached mapping from the serialized source solution.
+   */
+  void applyMapping(const CachedMapping & mapping, const NumericVector<Number> & from_solution, NumericVector<Number> & to_solution);
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
   bool _error_on_miss;
+
+  /// If true then the source dofs and weights feeding each target dof will be cached
+  bool _fixed_meshes;
+
+  /// True once the mappings have been built
+  bool _mappings_cached;
+
+  /// The cached mappings, indexed by the global app number
+  std::map<unsigned int, CachedMapping> _cached_mappings;
 };
 
 #endif /* MULTIAPPMESHFUNCTIONTRANSFER_H */
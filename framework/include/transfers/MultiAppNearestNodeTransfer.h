@@ -86,6 +86,8 @@ protected:
   bool _neighbors_cached;
   std::vector< std::vector<unsigned int> > _cached_froms;
   std::vector< std::vector<dof_id_type> > _cached_dof_ids;
+  /// The number of points sent to each processor
+  std::vector<unsigned int> _cached_qp_counts;
   std::map<unsigned int, unsigned int> _cached_from_inds;
   std::map<unsigned int, unsigned int> _cached_qp_inds;
 };
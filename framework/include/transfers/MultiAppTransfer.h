@@ -100,7 +100,31 @@ protected:
    */
   NumericVector<Real> & getTransferVector(unsigned int i_local, std::string var_name);
 
+  /**
+   * Return true if any of the meshes in _to_meshes and _from_meshes were replaced
+   * (e.g. by a MultiApp reset) or changed (e.g. by adaptivity) since the last call.
+   * Transfers caching a mapping between the meshes use this to know when to rebuild it.
+   * Call this after getAppInfo().
+   */
+  bool meshesChanged();
+
+  /**
+   * A linear map from source values to target dofs cached by transfers between fixed meshes.
+   * The value for _target_dofs[i] is the sum over j in [_offsets[i], _offsets[i+1]) of
+   * _weights[j] times the source value _sources[j].
+   */
+  struct CachedMapping
+  {
+    std::vector<dof_id_type> _target_dofs;
+    std::vector<unsigned int> _offsets;
+    std::vector<dof_id_type> _sources;
+    std::vector<Real> _weights;
+  };
+
 private:
+  /// The meshes and their change counts seen by the last call to meshesChanged()
+  std::vector<std::pair<MooseMesh *, unsigned int> > _mesh_states;
+
   // Given local app index, returns global app index.
   std::vector<unsigned int> _local2global_map;
 };
@@ -0,0 +1,67 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef DEFERREDREDUCTIONS_H
+#define DEFERREDREDUCTIONS_H
+
+#include "Moose.h"
+
+//libMesh includes
+#include "libmesh/parallel.h"
+
+#include <vector>
+
+class UserObject;
+
+/**
+ * Collects the values user objects would reduce one by one across the processors (see
+ * UserObject::deferReductions()) so that they can all be reduced together: one communication
+ * for the sums and one for the maxima and minima.
+ */
+class DeferredReductions
+{
+public:
+  DeferredReductions();
+
+  /// Register a value of user_object to be summed
+  void sum(UserObject & user_object, Real & value);
+
+  /// Register a value of user_object to be maximized
+  void max(UserObject & user_object, Real & value);
+
+  /// Register a value of user_object to be minimized
+  void min(UserObject & user_object, Real & value);
+
+  /**
+   * Reduce all the registered values in place.  Until clear() is called the user objects
+   * leave these values alone in their gatherSum(), gatherMax() and gatherMin() calls.
+   */
+  void reduce(const Parallel::Communicator & comm);
+
+  /// Forget the registered values
+  void clear();
+
+protected:
+  /// The values to sum and the user objects they belong to
+  std::vector<Real *> _sum_values;
+  std::vector<UserObject *> _sum_user_objects;
+
+  /// The values to maximize or minimize (the minima are reduced as negated maxima)
+  std::vector<Real *> _extreme_values;
+  std::vector<bool> _is_min;
+  std::vector<UserObject *> _extreme_user_objects;
+};
+
+#endif /* DEFERREDREDUCTIONS_H */
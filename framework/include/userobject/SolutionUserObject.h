@@ -16,6 +16,7 @@
 
 #include "GeneralUserObject.h"
 #include "libmesh/exodusII_io.h"
+#include "libmesh/mesh_tools.h"
 #include "MooseUtils.h"
 
 // Forward Declarations
@@ -57,6 +58,20 @@ public:
    */
   virtual Real pointValue(Real t, const Point & p, const std::string & var_name) const;
 
+  /**
+   * Returns the values at many locations of a variable (see pointValue)
+   * The locations are visited in a spatial order so consecutive points are usually found in the
+   * last located element, and the shape functions of an element are evaluated once for all the
+   * points inside it.  This is much cheaper than calling pointValue for every point.
+   * With 'distributed = true' this is collective: points outside the local part of the solution
+   * are evaluated by the processors holding them.
+   * @param t The time at which to extract (see pointValue)
+   * @param points The locations at which to return values
+   * @param var_name The variable that is desired
+   * @param values The desired values at the locations (resized to the number of points)
+   */
+  void pointValues(Real t, const std::vector<Point> & points, const std::string & var_name, std::vector<Real> & values) const;
+
   /**
    * Return a value directly from a Node
    * @param node A pointer to the node at which a value is desired
@@ -140,6 +155,38 @@ protected:
    */
   Real evalMeshFunction(const Point & p, std::string var_name, unsigned int func_num) const;
 
+  /**
+   * Applies the coordinate transformations to a point of the simulation
+   * @param p The point in the simulation
+   * @return The corresponding point in the mesh that was read
+   */
+  Point transformPoint(const Point & p) const;
+
+  /**
+   * Evaluates a variable at points (already transformed) located in the part of the solution held
+   * by this processor (see pointValues)
+   */
+  void localPointValues(const std::vector<Point> & pts, const std::string & var_name, std::vector<Real> & values) const;
+
+  /**
+   * Builds the copy of a system solution used to evaluate the data, a full serial copy or, when
+   * distributed, a ghosted vector holding the dofs of the elements overlapping _local_bbox
+   * @param system The system holding the solution
+   * @param send_list Filled with the ghosted dofs (distributed only)
+   * @return The new vector, filled with the solution
+   */
+  NumericVector<Number> * buildSolutionCopy(System & system, std::vector<numeric_index_type> & send_list);
+
+  /**
+   * Copies a system solution into a vector built by buildSolutionCopy
+   */
+  void localizeSolution(System & system, NumericVector<Number> & solution, const std::vector<numeric_index_type> & send_list);
+
+  /**
+   * Computes the region of the solution needed by every processor (distributed only)
+   */
+  void buildLocalBoundingBoxes();
+
   /// File type to read (0 = xda; 1 = ExodusII)
   MooseEnum _file_type;
 
@@ -242,6 +289,24 @@ protected:
   /// transformations (rotations, translation, scales) are performed in this order
   MultiMooseEnum _transformation_order;
 
+  /// If true only the part of the solution vectors around the local elements is stored (the mesh is always read in full)
+  bool _distributed;
+
+  /// Size of the layer around the local region, relative to its diagonal
+  Real _ghost_layer;
+
+  /// The region of the read mesh covered by the local solution (distributed only)
+  MeshTools::BoundingBox _local_bbox;
+
+  /// The region covered by the solution held by each processor (distributed only)
+  std::vector<MeshTools::BoundingBox> _proc_bboxes;
+
+  /// The ghosted dofs of _serialized_solution (distributed only)
+  std::vector<numeric_index_type> _send_list;
+
+  /// The ghosted dofs of _serialized_solution2 (distributed only)
+  std::vector<numeric_index_type> _send_list2;
+
   /// True if initial_setup has executed
   bool _initialized;
 };
@@ -31,6 +31,8 @@
 
 class UserObject;
 class FEProblem;
+class DeferredReductions;
+class SystemBase;
 
 template<>
 InputParameters validParams<UserObject>();
@@ -84,6 +86,20 @@ public:
    */
   virtual Real spatialValue(const Point & /*p*/) const { mooseError(_name << " does not satisfy the Spatial UserObject interface!"); }
 
+  /**
+   * Whether this object asked for a serialized solution with getSerializedSolution().  FEProblem
+   * only gathers the solution on every processor before executing user objects if one of them did.
+   */
+  bool needsSerializedSolution() const { return _needs_serialized_solution; }
+
+  /**
+   * Register the values gathered by getValue() in reductions, with reductions.sum(*this, value)
+   * etc.  FEProblem calls this after finalize() and reduces the values of all the postprocessors
+   * of an execution together, then gatherSum(), gatherMax() and gatherMin() leave the registered
+   * values alone in getValue().  Derived classes must call the method of their parent.
+   */
+  virtual void deferReductions(DeferredReductions & reductions);
+
   /**
    * Gather the parallel sum of the variable passed in. It takes care of values across all threads and CPUs (we DO hybrid parallelism!)
    *
@@ -92,19 +108,22 @@ public:
   template <typename T>
   void gatherSum(T & value)
   {
-    _communicator.sum(value);
+    if (!isReduced(&value))
+      _communicator.sum(value);
   }
 
   template <typename T>
   void gatherMax(T & value)
   {
-    _communicator.max(value);
+    if (!isReduced(&value))
+      _communicator.max(value);
   }
 
   template <typename T>
   void gatherMin(T & value)
   {
-    _communicator.min(value);
+    if (!isReduced(&value))
+      _communicator.min(value);
   }
 
   template <typename T1, typename T2>
@@ -128,6 +147,27 @@ protected:
 
   /// Coordinate system
   const Moose::CoordinateSystemType & _coord_sys;
+
+  /**
+   * Get a copy of the whole solution of a system on every processor, brought up to date before this
+   * object executes.  User objects otherwise only see the local and ghosted dofs, which is all the
+   * element loops need; call this (typically in the constructor) only when the object reads arbitrary
+   * remote dofs, since the gather is expensive on large problems.
+   * @param sys The system to get the serialized solution of
+   */
+  NumericVector<Number> & getSerializedSolution(SystemBase & sys);
+
+private:
+  /// Returns true if the value was already reduced by DeferredReductions
+  bool isReduced(const void * value) const;
+
+  /// The values reduced by DeferredReductions
+  std::vector<const void *> _reduced_values;
+
+  /// Whether getSerializedSolution() was called
+  bool _needs_serialized_solution;
+
+  friend class DeferredReductions;
 };
 
 
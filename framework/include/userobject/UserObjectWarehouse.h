@@ -27,6 +27,7 @@ class NodalUserObject;
 class SideUserObject;
 class InternalSideUserObject;
 class GeneralUserObject;
+class MooseVariable;
 
 /**
  * Holds user_objects and provides some services
@@ -114,6 +115,24 @@ public:
    */
   const std::vector<GeneralUserObject *> & genericUserObjects(GROUP group = ALL);
 
+  /**
+   * Get the variables that the element, internal side, side and nodal user_objects executed on a subdomain
+   * depend on.  The set is built the first time a subdomain is requested for a group and a set of boundary IDs and
+   * reused afterwards.
+   * @param subdomain_id Subdomain ID
+   * @param bnd_ids The boundary IDs touching the subdomain
+   * @param group - the type of user objects to consider, defaults to ALL
+   * @return The set of MooseVariables needed on the subdomain
+   */
+  const std::set<MooseVariable *> & subdomainVariableDependencies(SubdomainID subdomain_id, const std::set<unsigned int> & bnd_ids, GROUP group = ALL);
+
+  /**
+   * Whether any of the user objects of a group asked for a serialized solution (see UserObject::getSerializedSolution())
+   * @param group - the type of user objects to consider, defaults to ALL
+   * @return true if the solution has to be serialized before the group executes
+   */
+  bool needSerializedSolution(GROUP group = ALL);
+
   /**
    * Add a user_object
    * @param user_object UserObject being added
@@ -149,6 +168,10 @@ protected:
   template <typename T>
   void sortUserObjects(std::vector<T *> & pps_vector);
 
+  /// Returns true if one of the user objects asked for a serialized solution
+  template <typename T>
+  static bool anyNeedSerializedSolution(const std::vector<T *> & user_objects);
+
   /// Userobject Names
   std::map<std::string, UserObject *> _name_to_user_objects;
 
@@ -196,6 +219,9 @@ protected:
   /// All of the block ids that have nodal user_objects specified to act on them
   std::set<SubdomainID> _block_ids_with_nodal_user_objects;
 
+  /// Variables needed by the user_objects on a subdomain for each group and set of boundary IDs (built on demand)
+  std::map<std::pair<SubdomainID, GROUP>, std::map<std::set<unsigned int>, std::set<MooseVariable *> > > _subdomain_dependencies;
+
 private:
   /// Hold shared pointers for automatic cleanup
   std::vector<MooseSharedPointer<UserObject> > _all_ptrs;
@@ -34,6 +34,11 @@
  *   MOOSE direction that each grid axis corresponds to.  For instance,
  *   the first grid axis might correspond to the MOOSE "y" direction,
  *   the second grid axis might correspond to the MOOSE "t" direction, etc.
+ *
+ * The file is either the ASCII format described in GriddedData.C or
+ * its binary equivalent (see scripts/gridded_data_to_binary.py).  The
+ * function values of a binary file are memory mapped read-only, so
+ * they are shared by all the processes and threads of a node.
  */
 class GriddedData
 {
@@ -44,8 +49,7 @@ public:
    */
   GriddedData(std::string file_name);
 
-  virtual ~GriddedData()
-    {}
+  virtual ~GriddedData();
 
   /**
    * Returns the dimensionality of the grid.
@@ -90,6 +94,22 @@ private:
   std::vector<Real> _fcn;
   std::vector<unsigned int> _step;
 
+  /// The function values, in _fcn or in the mapped file
+  const Real * _fcn_data;
+  /// The number of function values
+  std::size_t _fcn_size;
+
+  /// The mapped binary file (NULL for ASCII files)
+  void * _map;
+  /// The size of the mapping
+  std::size_t _map_size;
+
+  /// Returns true if the file starts with the binary header
+  bool isBinary(const std::string & file_name);
+
+  /// Maps a binary file and reads its grid
+  void mapBinary(const std::string & file_name);
+
   void parse(unsigned int & dim, std::vector<int> & axes, std::vector<std::vector<Real> > & grid, std::vector<Real> & f, std::vector<unsigned int> & step, std::string file_name);
   bool getSignificantLine(std::ifstream & file_stream, std::string & line);
   void splitToRealVec(const std::string & input_string, std::vector<Real> & output_vec);
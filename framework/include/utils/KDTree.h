@@ -0,0 +1,111 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef KDTREE_H
+#define KDTREE_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/point.h"
+
+// System includes
+#include <vector>
+#include <queue>
+
+/**
+ * A k-d tree over a set of points for nearest neighbor queries.  The tree is built
+ * in O(n log n) and answers nearest neighbor queries in O(log n) on average, so it
+ * is cheap enough to rebuild every time the points move.
+ *
+ * The queries are const and can be made from several threads at once.
+ */
+class KDTree
+{
+public:
+  /**
+   * @param max_leaf_size The maximum number of points stored in a leaf of the tree
+   */
+  KDTree(unsigned int max_leaf_size = 10);
+
+  /**
+   * (Re)build the tree.  The points are copied, the indices returned by the queries
+   * are positions in this vector.
+   */
+  void build(const std::vector<Point> & points);
+
+  /**
+   * The number of points in the tree.
+   */
+  unsigned int size() const { return _points.size(); }
+
+  /**
+   * The point with the given index.
+   */
+  const Point & point(unsigned int i) const { return _points[i]; }
+
+  /**
+   * Find the point closest to p.  The tree must not be empty.  Among points at the same
+   * distance the one with the lowest index is returned, like a linear search would.
+   *
+   * @param p The point to search from
+   * @param distance The distance between p and the nearest point
+   * @return The index of the nearest point
+   */
+  unsigned int nearest(const Point & p, Real & distance) const;
+
+  /**
+   * Find the n points closest to p.
+   *
+   * @param p The point to search from
+   * @param n The number of points to find (less are returned if the tree holds fewer points)
+   * @param indices The indices of the points, sorted from the closest to the furthest
+   */
+  void neighborSearch(const Point & p, unsigned int n, std::vector<unsigned int> & indices) const;
+
+protected:
+  /// A node of the tree, it holds the range [_begin, _end) of _indices
+  struct TreeNode
+  {
+    unsigned int _begin;
+    unsigned int _end;
+    /// The dimension and coordinate of the splitting plane (interior nodes only)
+    unsigned int _split_dim;
+    Real _split_value;
+    /// Children in _nodes, _left is invalid_uint for leaves
+    unsigned int _left;
+    unsigned int _right;
+  };
+
+  /// Squared distances and indices, the largest distance on top
+  typedef std::priority_queue<std::pair<Real, unsigned int> > NeighborHeap;
+
+  /// Build the subtree holding [begin, end) of _indices and return its position in _nodes
+  unsigned int buildNode(unsigned int begin, unsigned int end);
+
+  void nearestSearch(unsigned int node_id, const Point & p, unsigned int & best, Real & best_distance_sq) const;
+
+  void neighborSearch(unsigned int node_id, const Point & p, unsigned int n, NeighborHeap & heap) const;
+
+  unsigned int _max_leaf_size;
+
+  std::vector<Point> _points;
+
+  /// Point indices, reordered so that every node holds a contiguous range
+  std::vector<unsigned int> _indices;
+
+  std::vector<TreeNode> _nodes;
+};
+
+#endif // KDTREE_H
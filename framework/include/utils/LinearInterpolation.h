@@ -65,6 +65,19 @@ public:
    */
   double sampleDerivative(double x) const;
 
+  /**
+   * Same as sample(), for callers evaluating at nearby abscissas in sequence (e.g. advancing time).
+   * The interval used last is tried first before falling back to a binary search.
+   * @param x The independent variable
+   * @param hint The index of the interval of the previous call, updated with the one used for x
+   */
+  double sample(double x, unsigned int & hint) const;
+
+  /**
+   * Same as sampleDerivative(), starting the search at a previously found interval (see sample())
+   */
+  double sampleDerivative(double x, unsigned int & hint) const;
+
   /**
    * This function will dump GNUPLOT input files that can be run to show the data points and
    * function fits
@@ -86,6 +99,13 @@ public:
 
 private:
 
+  /**
+   * Returns i such that _x[i] <= x < _x[i+1], x must be inside the data range
+   * @param x The independent variable
+   * @param hint The interval to check first (and the one after it), updated with the result
+   */
+  unsigned int findInterval(double x, unsigned int & hint) const;
+
   std::vector<double> _x;
   std::vector<double> _y;
 
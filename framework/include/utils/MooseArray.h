@@ -166,6 +166,17 @@ public:
    */
   void shallowCopy(std::vector<T> & rhs);
 
+  /**
+   * Doesn't actually make a copy of the data.
+   *
+   * Just makes _this_ object operate on the 'size' entries starting at 'data'.
+   * This is used to look at a piece of a larger block of memory that is owned
+   * somewhere else.
+   *
+   * The same warnings as for the other shallowCopy() methods apply!
+   */
+  void shallowCopy(T * data, const unsigned int size);
+
   /**
    * Actual operator=... really does make a copy of the data
    *
@@ -321,6 +332,16 @@ MooseArray<T>::shallowCopy(std::vector<T> & rhs)
   _allocated_size = rhs.size();
 }
 
+template<typename T>
+inline
+void
+MooseArray<T>::shallowCopy(T * data, const unsigned int size)
+{
+  _data = data;
+  _size = size;
+  _allocated_size = size;
+}
+
 template<typename T>
 inline
 MooseArray<T> &
@@ -0,0 +1,75 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SPARSEEXCHANGE_H
+#define SPARSEEXCHANGE_H
+
+#include "Moose.h"
+#include "libmesh/parallel.h"
+
+/**
+ * Helpers for exchanging data between the processors that actually have something for each other:
+ * the buffers are indexed by processor id and only the nonempty ones are sent, with nonblocking
+ * messages.
+ */
+namespace SparseExchange
+{
+  /**
+   * Size the buffers for a sparse exchange: receive_data[i] is resized to hold what
+   * processor i has in send_data for us.  This is a single alltoall of the sizes; after
+   * it only the processors with something to say to each other need to exchange messages.
+   */
+  template <typename T>
+  void sizeReceiveBuffers(const Parallel::Communicator & comm, const std::vector<std::vector<T> > & send_data, std::vector<std::vector<T> > & receive_data)
+  {
+    std::vector<unsigned int> sizes(comm.size());
+    for (processor_id_type i_proc = 0; i_proc < comm.size(); i_proc++)
+      sizes[i_proc] = send_data[i_proc].size();
+
+    comm.alltoall(sizes);
+
+    receive_data.resize(comm.size());
+    for (processor_id_type i_proc = 0; i_proc < comm.size(); i_proc++)
+      receive_data[i_proc].resize(sizes[i_proc]);
+  }
+
+  /**
+   * Post nonblocking sends of the nonempty buffers in send_data to the other processors.
+   * The buffers must not be touched until the requests are waited on.
+   */
+  template <typename T>
+  void send(const Parallel::Communicator & comm, const std::vector<std::vector<T> > & send_data, const Parallel::MessageTag & tag, std::vector<Parallel::Request> & requests)
+  {
+    requests.resize(comm.size());
+    for (processor_id_type i_proc = 0; i_proc < comm.size(); i_proc++)
+      if (i_proc != comm.rank() && !send_data[i_proc].empty())
+        comm.send(i_proc, send_data[i_proc], requests[i_proc], tag);
+  }
+
+  /**
+   * Post nonblocking receives from the other processors into the nonempty (already sized)
+   * buffers in receive_data.  requests[i] can be waited on before reading receive_data[i];
+   * it completes right away when nothing is expected from processor i.
+   */
+  template <typename T>
+  void receive(const Parallel::Communicator & comm, std::vector<std::vector<T> > & receive_data, const Parallel::MessageTag & tag, std::vector<Parallel::Request> & requests)
+  {
+    requests.resize(comm.size());
+    for (processor_id_type i_proc = 0; i_proc < comm.size(); i_proc++)
+      if (i_proc != comm.rank() && !receive_data[i_proc].empty())
+        comm.receive(i_proc, receive_data[i_proc], requests[i_proc], tag);
+  }
+}
+
+#endif // SPARSEEXCHANGE_H
@@ -0,0 +1,61 @@
+#!/usr/bin/env python
+import sys
+import subprocess
+import argparse
+import re
+import time
+
+# Compare the thread scaling of the residual assembly with and without Problem/colored_assembly.
+#
+# Example:
+#   ./colored_assembly_scaling.py ../test/moose_test-opt ../test/tests/kernels/simple_diffusion/simple_diffusion.i \
+#       --args Mesh/uniform_refine=4 --max-threads 64
+
+# PerfLog line for the residual element loop: name, number of calls, self time
+perf_re = re.compile(r'ComputeResidualThread\s+(\d+)\s+([0-9.]+)')
+
+# Run the executable and return the wall time and the time spent in ComputeResidualThread
+def run(options, n_threads, colored):
+  cmd = [options.executable, '-i', options.input, '--n-threads=%d' % n_threads,
+         'Problem/colored_assembly=%s' % ('true' if colored else 'false'),
+         'Outputs/print_perf_log=true'] + options.args
+
+  start = time.time()
+  output, _ = subprocess.Popen(cmd, stdout = subprocess.PIPE, stderr = subprocess.STDOUT).communicate()
+  wall = time.time() - start
+
+  match = perf_re.search(output)
+  if not match:
+    print output
+    sys.exit('Could not find ComputeResidualThread in the performance log of: ' + ' '.join(cmd))
+
+  return wall, float(match.group(2))
+
+def main():
+  parser = argparse.ArgumentParser(description='Residual assembly thread scaling with and without colored assembly')
+  parser.add_argument('executable', help='The MOOSE based executable to run')
+  parser.add_argument('input', help='The input file to run')
+  parser.add_argument('--max-threads', type=int, default=64, help='The largest number of threads to run with (the runs use 1, 2, 4, ...)')
+  parser.add_argument('--args', nargs='*', default=[], help='Additional command line arguments to pass to the executable')
+  options = parser.parse_args()
+
+  thread_counts = []
+  n = 1
+  while n <= options.max_threads:
+    thread_counts.append(n)
+    n *= 2
+
+  print '%8s | %12s %12s %8s | %12s %12s %8s' % ('threads', 'regular', 'residual', 'speedup', 'colored', 'residual', 'speedup')
+
+  base = {}
+  for n_threads in thread_counts:
+    line = '%8d |' % n_threads
+    for colored in [False, True]:
+      wall, residual = run(options, n_threads, colored)
+      if n_threads == 1:
+        base[colored] = residual
+      line += ' %12.3f %12.3f %8.2f |' % (wall, residual, base[colored] / residual if residual > 0 else 0.)
+    print line[:-2]
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,80 @@
+#!/usr/bin/env python
+import sys
+import struct
+import argparse
+
+# Convert an ASCII GriddedData file (as read by PiecewiseMultilinear) to the binary format
+# that GriddedData memory maps.  See GriddedData.C for a description of both formats.
+#
+# Example:
+#   ./gridded_data_to_binary.py cross_sections.txt cross_sections.bin
+
+axis_ids = {'AXIS X' : 0, 'AXIS Y' : 1, 'AXIS Z' : 2, 'AXIS T' : 3}
+
+# Return the significant (not empty and not comment) lines of the file
+def significant_lines(file_name):
+  with open(file_name) as f:
+    for line in f:
+      line = line.rstrip('\n')
+      if len(line) == 0 or line[0] == '#':
+        continue
+      yield line
+
+def parse(file_name):
+  axes = []
+  grid = []
+  values = []
+  reading_grid = False
+  reading_values = False
+
+  for line in significant_lines(file_name):
+    if reading_grid:
+      grid.append([float(x) for x in line.split()])
+      reading_grid = False
+    elif line in axis_ids:
+      axes.append(axis_ids[line])
+      reading_grid = True
+    elif reading_values:
+      values.extend([float(x) for x in line.split()])
+    elif line == 'DATA':
+      reading_values = True
+
+  if len(axes) == 0:
+    sys.exit('No valid data found in ' + file_name)
+  if len(grid) != len(axes):
+    sys.exit('Missing grid for the last axis in ' + file_name)
+
+  n_points = 1
+  for g in grid:
+    n_points *= len(g)
+  if n_points != len(values):
+    sys.exit('According to the AXIS statements the number of data points is %d but %d function values were read from %s' % (n_points, len(values), file_name))
+
+  return axes, grid, values
+
+def main():
+  parser = argparse.ArgumentParser(description='Convert an ASCII GriddedData file to the binary format')
+  parser.add_argument('input', help='The ASCII file')
+  parser.add_argument('output', help='The binary file to write')
+  parser.add_argument('--real-size', type=int, choices=[8], default=8, help='The size of Real in the MOOSE build (only double precision is supported)')
+  options = parser.parse_args()
+
+  axes, grid, values = parse(options.input)
+  dim = len(axes)
+
+  with open(options.output, 'wb') as out:
+    out.write(b'GRIDDATA')
+    out.write(struct.pack('=QQQ', 1, options.real_size, dim))
+    out.write(struct.pack('=%dq' % dim, *axes))
+    out.write(struct.pack('=%dQ' % dim, *[len(g) for g in grid]))
+    for g in grid:
+      out.write(struct.pack('=%dd' % len(g), *g))
+
+    # Write the values in chunks to keep the memory use down on large tables
+    chunk = 1 << 20
+    for i in range(0, len(values), chunk):
+      part = values[i:i + chunk]
+      out.write(struct.pack('=%dd' % len(part), *part))
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,79 @@
+# Transient solve with the finite differenced preconditioner where the mesh is only adapted during the
+# first steps: the coloring is recomputed after the mesh changes and reused on the later steps.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = CoefDiffusion
+    variable = u
+    coef = 0.1
+  [../]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Preconditioning]
+  [./FDP]
+    type = FDP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 0.1
+  solve_type = NEWTON
+  abort_on_solve_fail = true
+[]
+
+[Adaptivity]
+  marker = marker
+  max_h_level = 2
+  stop_time = 0.25
+  [./Indicators]
+    [./indicator]
+      type = GradientJumpIndicator
+      variable = u
+    [../]
+  [../]
+  [./Markers]
+    [./marker]
+      type = ErrorFractionMarker
+      indicator = indicator
+      coarsen = 0.1
+      refine = 0.7
+    [../]
+  [../]
+[]
+
+[Outputs]
+  print_perf_log = true
+[]
@@ -0,0 +1,139 @@
+# The source fields are uniform in space, so every inverse distance weighting reproduces them and
+# the values, which change every step, can be checked by hand.  The cached weights are used from
+# the second step on.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  # The MultiAppInterpolationTransfer object only works with SerialMesh
+  distribution = serial
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./source]
+  [../]
+  [./from_sub]
+  [../]
+  [./elemental_from_sub]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./t_func]
+    type = ParsedFunction
+    value = t
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./source]
+    type = FunctionAux
+    variable = source
+    function = t_func
+    execute_on = timestep_begin
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  # The values come from the sub app of the previous step, the postprocessors run before the MultiApp
+  [./nodal_from_sub]
+    type = ElementAverageValue
+    variable = from_sub
+  [../]
+  [./elemental_from_sub]
+    type = ElementAverageValue
+    variable = elemental_from_sub
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    execute_on = timestep_end
+    positions = '0.2 0.2 0'
+    input_files = fixed_meshes_sub.i
+  [../]
+[]
+
+[Transfers]
+  [./tosub]
+    type = MultiAppInterpolationTransfer
+    direction = to_multiapp
+    multi_app = sub
+    source_variable = source
+    variable = from_master
+    fixed_meshes = true
+  [../]
+  [./elemental_tosub]
+    type = MultiAppInterpolationTransfer
+    direction = to_multiapp
+    multi_app = sub
+    source_variable = source
+    variable = elemental_from_master
+    fixed_meshes = true
+  [../]
+  [./fromsub]
+    type = MultiAppInterpolationTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = source
+    variable = from_sub
+    fixed_meshes = true
+  [../]
+  [./elemental_fromsub]
+    type = MultiAppInterpolationTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = source
+    variable = elemental_from_sub
+    fixed_meshes = true
+  [../]
+[]
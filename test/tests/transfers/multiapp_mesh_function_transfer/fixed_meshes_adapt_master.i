@@ -0,0 +1,114 @@
+# Same as fixed_meshes_master.i, but the master mesh is refined after every step.  The cached
+# mappings point at the dofs of the old mesh, so they have to be rebuilt for the values to be right.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  # The MultiAppMeshFunctionTransfer doesn't work with ParallelMesh.
+  # See tosub_master.i and #2145 for more information.
+  distribution = serial
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./source]
+  [../]
+[]
+
+[Functions]
+  [./x_t]
+    type = ParsedFunction
+    value = x*t
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./source]
+    type = FunctionAux
+    variable = source
+    function = x_t
+    execute_on = timestep_begin
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Adaptivity]
+  marker = uniform
+  [./Markers]
+    [./uniform]
+      type = UniformMarker
+      mark = refine
+    [../]
+  [../]
+[]
+
+[Outputs]
+  print_perf_log = true
+[]
+
+[MultiApps]
+  [./sub]
+    positions = '0.1 0.1 0'
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    input_files = fixed_meshes_sub.i
+    execute_on = timestep_end
+  [../]
+[]
+
+[Transfers]
+  [./to_sub]
+    source_variable = source
+    direction = to_multiapp
+    variable = transferred_u
+    type = MultiAppMeshFunctionTransfer
+    multi_app = sub
+    fixed_meshes = true
+  [../]
+  [./elemental_to_sub]
+    source_variable = source
+    direction = to_multiapp
+    variable = elemental_transferred_u
+    type = MultiAppMeshFunctionTransfer
+    multi_app = sub
+    fixed_meshes = true
+  [../]
+[]
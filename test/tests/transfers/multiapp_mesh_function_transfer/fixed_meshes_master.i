@@ -0,0 +1,142 @@
+# The source fields are linear in space, so both directions are transferred exactly and the
+# values, which change every step, can be checked by hand.  The cached mappings are used from
+# the second step on.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  # The MultiAppMeshFunctionTransfer doesn't work with ParallelMesh.
+  # See tosub_master.i and #2145 for more information.
+  distribution = serial
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./source]
+  [../]
+  [./transferred_u]
+  [../]
+  [./elemental_transferred_u]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./x_t]
+    type = ParsedFunction
+    value = x*t
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./source]
+    type = FunctionAux
+    variable = source
+    function = x_t
+    execute_on = timestep_begin
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  # The values come from the sub app of the previous step, the postprocessors run before the MultiApp
+  [./nodal_from_sub]
+    type = PointValue
+    variable = transferred_u
+    point = '0.2 0.2 0'
+  [../]
+  [./elemental_from_sub]
+    type = PointValue
+    variable = elemental_transferred_u
+    point = '0.25 0.25 0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
+
+[MultiApps]
+  [./sub]
+    positions = '0.1 0.1 0'
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    input_files = fixed_meshes_sub.i
+    execute_on = timestep_end
+  [../]
+[]
+
+[Transfers]
+  [./to_sub]
+    source_variable = source
+    direction = to_multiapp
+    variable = transferred_u
+    type = MultiAppMeshFunctionTransfer
+    multi_app = sub
+    fixed_meshes = true
+  [../]
+  [./elemental_to_sub]
+    source_variable = source
+    direction = to_multiapp
+    variable = elemental_transferred_u
+    type = MultiAppMeshFunctionTransfer
+    multi_app = sub
+    fixed_meshes = true
+  [../]
+  [./from_sub]
+    source_variable = source
+    direction = from_multiapp
+    variable = transferred_u
+    type = MultiAppMeshFunctionTransfer
+    multi_app = sub
+    fixed_meshes = true
+  [../]
+  [./elemental_from_sub]
+    source_variable = source
+    direction = from_multiapp
+    variable = elemental_transferred_u
+    type = MultiAppMeshFunctionTransfer
+    multi_app = sub
+    fixed_meshes = true
+  [../]
+[]
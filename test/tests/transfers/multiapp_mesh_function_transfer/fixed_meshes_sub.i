@@ -0,0 +1,87 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  xmax = 0.2
+  ymax = 0.2
+[]
+
+[Variables]
+  [./sub_u]
+  [../]
+[]
+
+[AuxVariables]
+  [./source]
+  [../]
+  [./transferred_u]
+  [../]
+  [./elemental_transferred_u]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./x_t]
+    type = ParsedFunction
+    value = x*t
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = sub_u
+  [../]
+[]
+
+[AuxKernels]
+  [./source]
+    type = FunctionAux
+    variable = source
+    function = x_t
+    execute_on = timestep_begin
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = sub_u
+    boundary = left
+    value = 1
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = sub_u
+    boundary = right
+    value = 4
+  [../]
+[]
+
+[Postprocessors]
+  [./nodal_from_master]
+    type = ElementAverageValue
+    variable = transferred_u
+  [../]
+  [./elemental_from_master]
+    type = ElementAverageValue
+    variable = elemental_transferred_u
+  [../]
+[]
+
+[Executioner]
+  # Preconditioned JFNK (default)
+  type = Transient
+  num_steps = 3
+  dt = 1
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
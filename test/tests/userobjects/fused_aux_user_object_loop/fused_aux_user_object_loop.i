@@ -0,0 +1,77 @@
+# u = x, so the average of u is 0.5, and the elemental aux variable 'two' goes from 0 to 2 at timestep_end.
+# aux_average couples to 'two' and has to see the new values, which keeps the aux kernels and the user
+# objects in separate loops even with Problem/fused_aux_user_object_loop = true.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./two]
+    order = CONSTANT
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./two]
+    type = ConstantAux
+    variable = two
+    value = 2
+    execute_on = timestep_end
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./u_average]
+    type = ElementAverageValue
+    variable = u
+    execute_on = timestep_end
+  [../]
+  [./aux_average]
+    type = ElementAverageValue
+    variable = two
+    execute_on = timestep_end
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+  nl_rel_tol = 1e-12
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
@@ -0,0 +1,47 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef KDTREETEST_H
+#define KDTREETEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+// Moose includes
+#include "KDTree.h"
+
+class KDTreeTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( KDTreeTest );
+
+  CPPUNIT_TEST( nearestTest );
+  CPPUNIT_TEST( neighborSearchTest );
+  CPPUNIT_TEST( duplicatePointsTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp();
+
+  void nearestTest();
+  void neighborSearchTest();
+  void duplicatePointsTest();
+
+private:
+  /// Points on a 10x10x10 lattice with unit spacing
+  std::vector<Point> _points;
+};
+
+#endif  // KDTREETEST_H
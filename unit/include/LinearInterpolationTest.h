@@ -24,6 +24,7 @@ class LinearInterpolationTest : public CppUnit::TestFixture
 
   CPPUNIT_TEST( constructor );
   CPPUNIT_TEST( sample );
+  CPPUNIT_TEST( sampleWithHint );
   CPPUNIT_TEST( getSampleSize );
 
   CPPUNIT_TEST_SUITE_END();
@@ -34,6 +35,7 @@ public:
 
   void constructor();
   void sample();
+  void sampleWithHint();
   void getSampleSize();
 
 private: